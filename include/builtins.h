@@ -17,13 +17,34 @@
 
 const char	*skip_whitespace_and_sign(const char *str, int *sign);
 void		init_builtins(t_bltn_cmd *commands);
-int			ft_cd(t_cmd *cmd, t_shell *shell);
-int			ft_echo(t_cmd *cmd, t_shell *shell);
-int			ft_env(t_cmd *cmd, t_shell *shell);
-int			ft_export(t_cmd *cmd, t_shell *shell);
-int			ft_pwd(t_cmd *cmd, t_shell *shell);
-int			ft_unset(t_cmd *cmd, t_shell *shell);
-int			ft_exit(t_cmd *cmd, t_shell *sh);
+int			ft_cd(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_echo(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_env(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_export(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_pwd(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_unset(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_exit(t_cmd *cmd, t_io *io, t_shell *sh);
+int			ft_hash(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_set(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_jobs(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_wait(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_parallel(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_exec(t_cmd *cmd, t_io *io, t_shell *shell);
+int			exec_redirections(t_cmd *cmd, t_fd_map *map, t_shell *shell);
+bool		is_pure_builtin(t_cmd *cmd);
+bool		builtin_reads_input(t_cmd *cmd);
+int			ft_cat(t_cmd *cmd, t_io *io, t_shell *shell);
+int			ft_tee(t_cmd *cmd, t_io *io, t_shell *shell);
+int			tee_spliced(t_tee *ctx);
+int			open_tee_files(t_tee *ctx, char **names, int flags,
+				t_shell *shell);
+bool		open_spare(t_tee *ctx);
+void		close_spare(t_tee *ctx);
+int			builtin_operands(char **args, const char *letters);
+bool		builtin_has_option(char **args, int end, char letter);
+int			builtin_external(t_cmd *cmd, t_io *io, t_shell *shell);
+void		format_job(t_list *node, t_outbuf *out, t_shell *shell);
+int			print_hash_table(t_io *io, t_shell *shell);
 int			handle_exit_errors(int error_code, char *arg, t_shell *shell);
 t_bltn_func	fetch_builtin_cmd(char *command);
 
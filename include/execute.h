@@ -16,25 +16,115 @@
 # include "minishell.h"
 
 // ----- EXECUTE ----- //
-pid_t	run_pipe_cmd(t_list *pipe_lst, int last_pipe_fd,
-			int pipe_fds[2], t_shell *shell);
+t_stage	run_pipe_cmd(t_ast *node, t_fd_plan *plan, t_inline_stage *inl,
+			t_shell *shell);
 int		run_cmd(t_ast *ast_node, t_op_status op_status, t_shell *shell);
 int		handle_exit_signal(int child_status, bool *printed_newline,
 			t_shell *shell);
 int		process_cmd(t_cmd *cmd, t_op_status term_status, t_shell *shell);
+int		launch_external(t_cmd *cmd, t_op_status term_status, t_shell *shell);
+t_stage	spawn_program(t_cmd *cmd, t_fd_map *map, t_shell *shell);
 int		process_logic(t_logic *logic, t_shell *shell);
 int		process_brace(t_brace *brace, t_shell *shell);
 
 char	**generate_paths(t_shell *shell);
 char	*find_executable_path(char *cmd, t_shell *shell);
-char	*locate_executable(char *bin_name, t_shell *sh);
+int		resolve_executable(char *cmd, char **exec_path, t_shell *shell);
+int		resolve_in_path(char *name, char **exec_path, t_shell *sh);
+int		report_cmd_error(char *name, char *msg, int status, t_shell *shell);
+char	*search_path(char *bin_name, bool *access_error, t_shell *sh);
+char	*join_exec_path(const char *dir, const char *name, t_shell *shell);
+int		probe_path_dir(t_path_dirs *pd, int i, const char *name);
+void	free_path_dirs(t_shell *shell);
+void	neg_cache_clear(t_shell *shell);
+void	neg_cache_add(const char *name, t_shell *shell);
+bool	neg_cache_hit(const char *name, t_shell *shell);
 
-int		execute_command_chain(t_list *pipe_lst, t_shell *shell);
-int		collect_child_statuses(pid_t last_exec_pid, int pipe_count,
+t_path_dirs		*get_path_dirs(t_shell *shell);
+
+t_list			*hash_find(const char *name, t_shell *shell);
+t_hash_entry	*hash_store(const char *name, const char *path, int hits,
+					t_shell *shell);
+bool			hash_remove(const char *name, t_shell *shell);
+void			hash_sync(t_shell *shell);
+void			hash_reset(t_shell *shell);
+void			free_hash_entry(void *data);
+char			*hash_lookup(const char *name, t_shell *shell);
+
+void	supervise_child(pid_t pid, t_shell *shell);
+int		supervisor_poll(int timeout_ms, t_shell *shell);
+void	supervisor_reset(t_shell *shell);
+void	init_supervisor(t_shell *shell);
+void	release_child(pid_t pid, t_shell *shell);
+t_child	await_child(pid_t pid, t_shell *shell);
+t_child	*add_child(pid_t pid, t_shell *shell);
+t_child	*find_child(pid_t pid, t_shell *shell);
+
+int		process_bg(t_bg *bg, t_shell *shell);
+int		job_exit_code(int raw_status);
+t_job	*add_job(pid_t pid, char *text, t_shell *shell);
+bool	update_job(t_job *job, bool block, t_shell *shell);
+void	free_job(void *data);
+void	remove_job(t_job *job, t_shell *shell);
+t_job	*find_job(char *spec, t_shell *shell);
+char	job_marker(t_list *node);
+void	refresh_jobs(t_shell *shell);
+void	report_jobs(t_shell *shell);
+void	free_jobs(t_shell *shell);
+
+void	account_usage(struct rusage *usage, t_shell *shell);
+int		process_timed(t_timed *timed, t_shell *shell);
+void	print_time_report(t_time_report *r, int flags, t_shell *shell);
+void	report_json(t_time_report *r, t_outbuf *buf, t_shell *shell);
+void	perf_start(int *fds);
+void	perf_stop(int *fds, long long *values);
+char	*counter_name(t_counter counter, bool json);
+
+int		run_parallel(t_parallel *par, t_shell *shell);
+int		prepare_parallel(t_parallel *par, t_shell *shell);
+bool	prepare_job(t_parallel *par, int index, t_cmd *cmd, t_shell *shell);
+int		open_capture(t_shell *shell);
+
+bool	is_pure_ast(t_ast *node);
+void	release_held_fds(t_shell *shell);
+bool	hold_inline_stage(t_inline_stage *inl, t_ast *node, t_fd_plan *plan,
 			t_shell *shell);
+t_stage	run_inline_stage(t_inline_stage *inl, t_shell *shell);
+int		execute_command_chain(t_list *pipe_lst, t_shell *shell);
+void	collect_child_statuses(t_stage *stages, int count, t_shell *shell);
+void	record_status(int status, t_shell *shell);
+int		pipeline_status(t_stage *stages, int count, t_shell *shell);
 int		process_pipeline(t_ast *ast_node, t_shell *shell);
-int		process_input_redirection(t_redir *redirect, t_shell *shell);
-int		process_output_redirection(t_redir *redirect, t_shell *shell);
-int		process_redirection(t_redir *redirect, t_shell *shell);
+int		process_redirection(t_ast *node, t_op_status op_status,
+			t_shell *shell);
+t_stage	spawn_redirected(t_ast *node, t_fd_plan *base, t_shell *shell);
+t_ast	*redir_target(t_ast *node);
+bool	redirects_external(t_ast *node, t_shell *shell);
+int		open_redir_file(t_redir *redir, t_shell *shell);
+int		open_heredoc(t_redir *redir, t_shell *shell);
+void	init_fd_map(t_fd_map *map, t_fd_plan *plan);
+int		build_fd_map(t_ast *node, t_fd_plan *plan, t_fd_map *map,
+			t_shell *shell);
+void	release_fd_map(t_fd_map *map);
+int		schedule_fd_map(t_fd_map *map, t_fd_step *steps, t_shell *shell);
+void	apply_fd_steps(t_fd_map *map, t_fd_step *steps, int count,
+			t_shell *shell);
+void	save_fd_targets(t_fd_map *map, t_fd_step *steps, int count,
+			int *saved);
+void	restore_fd_targets(t_fd_step *steps, int count, int *saved,
+			t_shell *shell);
+void	init_io(t_io *io, t_fd_plan *plan);
+int		run_builtin(t_bltn_func function, t_cmd *cmd, t_io *io,
+			t_shell *shell);
+bool	redirects_builtin(t_ast *node, t_shell *shell);
+int		redirect_builtin(t_ast *node, t_shell *shell);
+void	resolve_word(char *word, t_list **words, t_shell *shell);
+void	finish_proc_substs(t_shell *shell);
+int		add_proc_subst_fds(posix_spawn_file_actions_t *actions, char **args,
+			t_shell *shell);
+void	keep_proc_substs(char **args, t_shell *shell);
+void	release_proc_substs(t_ast *node, t_shell *shell);
+t_ast	*parse_command_text(char *text, t_shell *shell);
+char	*command_subst(char *text, t_shell *shell);
 
 #endif
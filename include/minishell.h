@@ -21,6 +21,15 @@
 # include <fcntl.h>
 # include <sys/types.h>
 # include <sys/wait.h>
+# include <spawn.h>
+# include <sys/epoll.h>
+# include <sys/resource.h>
+# include <sys/syscall.h>
+# include <sys/mman.h>
+# include <sys/sendfile.h>
+# include <sys/time.h>
+# include <time.h>
+# include <linux/perf_event.h>
 # include <sys/stat.h>
 # include <dirent.h>
 # include <string.h>
@@ -55,6 +64,7 @@ t_tkn_type	get_ampersand(char *input, size_t *len, t_shell *shell);
 t_tkn_type	get_pipe(char *input, size_t *len, t_shell *shell);
 t_tkn_type	get_redirect(char *input, char c, size_t *len, t_shell *shell);
 t_tkn_type	get_word(char *input, size_t *len, t_shell *shell);
+size_t		subst_len(const char *input);
 ssize_t		write_and_track(const char *str, int fd, t_shell *shell);
 t_list		*create_ev_list(char **env_vars, t_shell *shell);
 t_list		*get_ev(char *target, t_list *ev_list);
@@ -67,6 +77,10 @@ void		add_ev(char *name, char *value, t_list **ev_list, t_shell *shell);
 void		change_ev_val(t_list *ev_ptr, char *new_val,
 				bool retain_old, t_shell *shell);
 void		free_ev(void *data);
+void		mark_ev_changed(char *name, t_shell *shell);
+void		free_ev_index(t_shell *shell);
+t_env_var	**get_sorted_ev(t_shell *shell);
+char		**get_ev_array(t_shell *shell);
 void		exit_on_error(const char *cause, char *msg,
 				int exit_code, t_shell *shell);
 void		exit_on_sys_error(const char *cause, int errnum, t_shell *shell);
@@ -74,10 +88,14 @@ void		cleanup_shell(t_shell *shell);
 void		*record_synt_err(char *tkn, t_shell *shell);
 void		reset_readline(bool redisplay);
 void		conf_signal(int signum, void (*handler)(int));
+void		signals_child(t_shell *shell);
 void		signal_std(void);
 void		signals_ignore(void);
 void		signals_default(void);
 void		signal_heredoc(void);
+void		catch_sigint(t_shell *shell);
+void		release_sigint(t_shell *shell);
+bool		sigint_received(void);
 void		on_sigint_std(int signum);
 void		lstadd_front_tracked(void *content, t_list **lst,
 				t_mem_trackers tracker, t_shell *shell);
@@ -104,9 +122,9 @@ char		*strdup_tracked(char const *str, t_mem_trackers tracker,
 				t_shell *shell);
 char		*get_ev_value(t_list *ev_node);
 char		*get_input(t_input_type input_type);
-char		**create_ev_array(t_shell *shell);
 int			main(int argc, char **argv, char **envp);
-int			display_ev_list(bool export_mode, t_list *ev, t_shell *shell);
+int			display_ev_list(bool export_mode, t_list *ev, t_outbuf *out,
+				t_shell *shell);
 int			error_msg_errno(char *cause, t_shell *shell);
 int			error_msg(char *cause, char *faulty_el, char *msg, t_shell *shell);
 int			is_special_tkn(int c);
@@ -29,6 +29,11 @@ t_ast		*build_node_redir(t_tkn_type redir_type, t_list *token,
 t_ast		*build_node_brace(t_ast *inner_node, t_shell *shell);
 t_ast		*parse_pipe(t_list **tkn_list, t_shell *shell);
 t_ast		*parse_logic(t_list **tkn_list, t_shell *shell);
+t_ast		*parse_list(t_list **tkn_list, t_shell *shell);
+t_ast		*build_node_bg(t_ast *command, t_ast *next, char *text,
+				t_shell *shell);
+t_ast		*build_node_timed(t_ast *command, int flags, t_shell *shell);
+t_ast		*parse_timed(t_list **tkn_list, t_shell *shell);
 t_ast		*link_redir_to_cmd(t_ast *redir_sequence, t_ast *cmd);
 t_ast		*assemble_cmd(t_ast *redir_prefix, t_ast *redir_suffix, t_ast *cmd);
 t_ast		*find_redir_tail(t_ast *redir_head);
@@ -39,7 +44,9 @@ t_ast		*extract_redirections(t_list **tokens, t_ast *cmd_node,
 char		*get_tkn_label(t_tkn_type tkn_type);
 char		*get_value(t_list *tkn);
 bool		add_cmd_arg(t_list **tokens, t_ast *cmd_node, t_shell *shell);
+char		*redir_label(t_tkn_type type);
 bool		is_valid_redir(t_list **tokens, t_ast *cmd_node);
+bool		collect_heredoc(t_redir *redir, t_shell *shell);
 int			parse_tokens(t_list *tokens, t_ast **syntax_tree, t_shell *shell);
 
 #endif
\ No newline at end of file
@@ -16,17 +16,154 @@
 # include "minishell.h"
 
 // ----- SHELL ----- //
+typedef struct s_env_var	t_env_var;
+
+typedef struct s_ev_index
+{
+	t_env_var		**vars;
+	unsigned int	gen;
+	char			**envp;
+	unsigned int	envp_gen;
+}	t_ev_index;
+
+# define HASH_BUCKETS 64
+
+typedef struct s_path_dirs
+{
+	char			**dirs;
+	int				*fds;
+	int				count;
+	unsigned int	gen;
+}	t_path_dirs;
+
+# define NEG_CACHE_SIZE 32
+
+typedef struct s_neg_cache
+{
+	char			*names[NEG_CACHE_SIZE];
+	int				next;
+	unsigned int	path_gen;
+	unsigned long	fs_epoch;
+	struct timespec	*mtimes;
+	int				mtime_count;
+}	t_neg_cache;
+
+typedef struct s_pipestatus
+{
+	int		*codes;
+	int		count;
+	int		cap;
+	bool	held;
+}	t_pipestatus;
+
+typedef struct s_child
+{
+	pid_t			pid;
+	int				pidfd;
+	int				status;
+	bool			done;
+	struct rusage	usage;
+}	t_child;
+
+typedef struct s_job
+{
+	int		id;
+	pid_t	pid;
+	char	*text;
+	int		status;
+	bool	done;
+}	t_job;
+
+# define JOB_STATE_WIDTH 24
+
+# define SUP_EVENTS 16
+
+typedef struct s_supervisor
+{
+	int		epfd;
+	int		fd_budget;
+	t_child	*children;
+	int		count;
+	int		cap;
+}	t_supervisor;
+
+typedef struct s_proc_subst
+{
+	pid_t	pid;
+	int		fd;
+}	t_proc_subst;
+
 typedef struct s_shell
 {
-	t_list	*ev_list;
-	t_list	*temp_files;
-	t_list	*mem_tracker[3];
-	char	*home_dir;
-	char	*syntax_error;
-	bool	is_main;
-	int		prev_cmd_status;
+	t_list			*ev_list;
+	t_list			*mem_tracker[3];
+	char			*home_dir;
+	char			*syntax_error;
+	bool			hdoc_interrupted;
+	bool			is_main;
+	int				prev_cmd_status;
+	unsigned int	ev_gen;
+	t_ev_index		ev_index;
+	unsigned int	path_gen;
+	unsigned int	hash_gen;
+	t_list			*cmd_hash[HASH_BUCKETS];
+	t_path_dirs		path_dirs;
+	t_neg_cache		neg_cache;
+	unsigned long	fs_epoch;
+	t_pipestatus	pipestatus;
+	bool			pipefail;
+	t_supervisor	sup;
+	t_list			*jobs;
+	pid_t			last_bg_pid;
+	bool			is_async;
+	struct rusage	child_usage;
+	bool			broken_pipe;
+	int				held_fds[2];
+	int				err_fd;
+	t_list			*proc_substs;
 }	t_shell;
 
+typedef struct s_outbuf
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+}	t_outbuf;
+
+# define OUTBUF_MIN_CAP 256
+# define COPY_CHUNK 1048576
+# define RANGE_CHUNK 1073741824
+# define COPY_BUF_SIZE 65536
+
+typedef enum e_copy_mode
+{
+	COPY_RANGE,
+	COPY_SPLICE,
+	COPY_SENDFILE,
+	COPY_READ
+}	t_copy_mode;
+
+typedef struct s_tee
+{
+	int		in;
+	int		out;
+	int		*files;
+	char	**names;
+	int		count;
+	int		tmp[2];
+	bool	out_is_pipe;
+	char	*failed;
+}	t_tee;
+
+typedef struct s_io
+{
+	int			in;
+	int			out;
+	int			err;
+	t_outbuf	buf;
+	bool		captured;
+}	t_io;
+
 typedef enum e_input_type
 {
 	IN_STD,
@@ -43,8 +180,15 @@ typedef enum e_tkn_type
 	T_INPUT,
 	T_OUTPUT,
 	T_HDOC,
+	T_HSTR,
+	T_RDWR,
+	T_DUP_IN,
+	T_DUP_OUT,
+	T_OUT_ALL,
+	T_APPEND_ALL,
 	T_BRACE_START,
 	T_BRACE_END,
+	T_BG,
 	T_ERR
 }	t_tkn_type;
 
@@ -61,12 +205,16 @@ typedef enum e_node_type
 	LOGIC,
 	PIPE,
 	REDIR,
+	BG,
+	TIME,
 	ERROR
 }	t_node_type;
 
 typedef struct s_cmd
 {
 	char	**cmd_args;
+	char	*exec_path;
+	bool	is_resolved;
 }	t_cmd;
 
 typedef struct s_pipe
@@ -85,8 +233,12 @@ typedef struct s_logic
 typedef struct s_redir
 {
 	t_tkn_type		redir_type;
+	int				fd;
 	struct s_ast	*command;
 	char			*filename;
+	char			*body;
+	size_t			body_len;
+	bool			expand_body;
 }	t_redir;
 
 typedef struct s_brace
@@ -94,6 +246,23 @@ typedef struct s_brace
 	struct s_ast	*command;
 }	t_brace;
 
+typedef struct s_bg
+{
+	struct s_ast	*command;
+	struct s_ast	*next;
+	char			*text;
+}	t_bg;
+
+# define TIME_POSIX 1
+# define TIME_JSON 2
+# define TIME_VERBOSE 4
+
+typedef struct s_timed
+{
+	struct s_ast	*command;
+	int				flags;
+}	t_timed;
+
 typedef struct s_error
 {
 	char	*invalid_tkn;
@@ -110,6 +279,8 @@ typedef struct s_ast
 		t_pipe	pipe;
 		t_redir	redir;
 		t_brace	brace;
+		t_bg	bg;
+		t_timed	timed;
 
 	} u_node_cont;
 }	t_ast;
@@ -142,9 +313,99 @@ typedef enum e_op_status
 # define PIPE_INPUT 0
 # define PIPE_OUTPUT 1
 
+typedef struct s_stage
+{
+	pid_t	pid;
+	int		status;
+}	t_stage;
+
+typedef struct s_fd_plan
+{
+	int	in;
+	int	out;
+	int	err;
+	int	spare;
+}	t_fd_plan;
+
+# define FD_MAP_SIZE 10
+# define FD_CLOSED -1
+
+typedef struct s_fd_map
+{
+	int		fds[FD_MAP_SIZE];
+	bool	owned[FD_MAP_SIZE];
+}	t_fd_map;
+
+typedef struct s_fd_step
+{
+	int	src;
+	int	dst;
+}	t_fd_step;
+
+typedef struct s_inline_stage
+{
+	struct s_ast	*node;
+	t_fd_plan		plan;
+	int				index;
+}	t_inline_stage;
+
+typedef struct s_time_sample
+{
+	struct timespec	wall;
+	struct rusage	self;
+	struct rusage	children;
+}	t_time_sample;
+
+typedef enum e_counter
+{
+	CTR_TASK_CLOCK,
+	CTR_CTX_SWITCHES,
+	CTR_PAGE_FAULTS,
+	CTR_CYCLES,
+	CTR_INSTRUCTIONS,
+	CTR_COUNT
+}	t_counter;
+
+typedef struct s_time_report
+{
+	long long	real_us;
+	long long	user_us;
+	long long	sys_us;
+	long		maxrss;
+	long		minflt;
+	long		majflt;
+	long		nvcsw;
+	long		nivcsw;
+	int			status;
+	bool		verbose;
+	long long	counters[CTR_COUNT];
+}	t_time_report;
+
+typedef struct s_par_slot
+{
+	pid_t	pid;
+	int		index;
+	int		out;
+	int		err;
+}	t_par_slot;
+
+typedef struct s_parallel
+{
+	char		**tmpl;
+	int			tmpl_len;
+	char		**inputs;
+	int			count;
+	int			max_jobs;
+	char		*exec_path;
+	int			null_fd;
+	t_io		*io;
+	t_stage		*stages;
+	t_par_slot	*slots;
+}	t_parallel;
+
 // ----- BUILTINS ----- //
 
-typedef int			(*t_bltn_func)(t_cmd *, t_shell *);
+typedef int			(*t_bltn_func)(t_cmd *, t_io *, t_shell *);
 
 typedef struct s_bltn_cmd
 {
@@ -152,15 +413,24 @@ typedef struct s_bltn_cmd
 	t_bltn_func	cmd_func;
 }	t_bltn_cmd;
 
-# define NUM_BUILTINS 7
+# define NUM_BUILTINS 15
+
+// ----- COMMAND HASH ----- //
+
+typedef struct s_hash_entry
+{
+	char	*name;
+	char	*path;
+	int		hits;
+}	t_hash_entry;
 
 // ----- ENV VARIABLES ----- //
 
-typedef struct s_env_var
+struct s_env_var
 {
 	char	*name;
 	char	*value;
-}	t_env_var;
+};
 
 typedef enum e_mem_trackers
 {
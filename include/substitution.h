@@ -39,6 +39,9 @@ void	process_unquoted_chars(char *arg,
 			t_subst_context *context, t_shell *shell);
 void	resolve_arg(char *arg, t_list **arg_list, t_shell *shell);
 void	process_filename(t_subst_context *ctx, t_shell *shell);
+void	resolve_redir_word(t_redir *redir, t_shell *shell);
+void	expand_cmd_subst(char *input, t_subst_context *context,
+			t_shell *shell);
 char	**create_string_array(t_list **list, t_shell *shell);
 char	*handle_tokens(char **tokens, t_subst_context *context,
 			t_shell *shell, char *str);
@@ -46,5 +49,10 @@ char	*tokenize_words(t_subst_context *context, char *str,
 			t_shell *shell);
 char	*extract_ev_value(char *input, t_subst_context *context,
 			t_shell *shell);
+char	*lookup_param(char *name, t_shell *shell);
+char	*last_bg_pid_value(t_shell *shell);
+char	*format_pipestatus(t_shell *shell);
+char	*pipestatus_element(int index, t_shell *shell);
+char	*brace_param(char *str, size_t *len, t_shell *shell);
 
 #endif
\ No newline at end of file
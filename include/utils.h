@@ -17,7 +17,7 @@
 
 //________UTILS________//
 struct dirent	*read_directory(DIR *directory, t_shell *shell);
-pid_t			wait_for_child(int *status, t_shell *shell);
+pid_t			wait_for_child(pid_t pid, int *status, t_shell *shell);
 pid_t			create_process(t_shell *shell);
 DIR				*open_directory(const char *path, t_shell *shell);
 void			append_str(char ***args, char *str, t_shell *shell);
@@ -31,5 +31,16 @@ int				close_file(int fd, t_shell *shell);
 int				get_file_status(const char *restrict file_path,
 					struct stat *restrict file_stat, t_shell *shell);
 int				duplicate_fd(int source_fd, int target_fd, t_shell *shell);
+void			outbuf_add(t_outbuf *buf, const char *data, size_t len,
+					t_shell *shell);
+void			outbuf_append(t_outbuf *buf, const char *str, t_shell *shell);
+ssize_t			outbuf_flush(t_outbuf *buf, int fd, t_shell *shell);
+void			outbuf_append_num(t_outbuf *buf, long long n, int width,
+					t_shell *shell);
+void			outbuf_append_fixed(t_outbuf *buf, long long micros,
+					int decimals, t_shell *shell);
+int				copy_fd_contents(int src_fd, int dst_fd);
+int				write_all(int fd, const char *data, ssize_t len);
+int				raise_fd(int fd);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_options.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:01:21 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 01:01:21 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether an argument of a builtin looks like an option.
+ *
+ * @param arg The argument, or NULL past the last one.
+ * @return true for a word of two or more characters starting with `-`.
+ */
+static bool	is_option(char *arg)
+{
+	return (arg && arg[0] == '-' && arg[1]);
+}
+
+/**
+ * @brief Finds the operands of a command a file builtin can run.
+ *
+ * Only options made of the given letters (alone or grouped, as in `-au`)
+ * and a final `--` may come before the operands. Other options, and
+ * options after an operand (which the GNU tools still honour), need the
+ * external program.
+ *
+ * @param args Arguments of the command, its name first.
+ * @param letters Option letters the builtin supports.
+ * @return Index of the first operand (of the terminating NULL if there
+ * is none), or -1 if the builtin does not support the options.
+ */
+int	builtin_operands(char **args, const char *letters)
+{
+	int	first;
+	int	i;
+
+	first = 1;
+	while (is_option(args[first]) && ft_strcmp(args[first], "--"))
+	{
+		i = 1;
+		while (args[first][i] && ft_strchr(letters, args[first][i]))
+			i++;
+		if (args[first][i])
+			return (-1);
+		first++;
+	}
+	if (args[first] && !ft_strcmp(args[first], "--"))
+		return (first + 1);
+	i = first;
+	while (args[i])
+	{
+		if (is_option(args[i++]))
+			return (-1);
+	}
+	return (first);
+}
+
+/**
+ * @brief Tells whether an option letter is given before the operands.
+ *
+ * @param args Arguments of the command, its name first.
+ * @param end Index of the first operand (see `builtin_operands`).
+ * @param letter Option letter to look for.
+ * @return true if one of the options contains `letter`.
+ */
+bool	builtin_has_option(char **args, int end, char letter)
+{
+	int	i;
+
+	i = 0;
+	while (++i < end)
+	{
+		if (ft_strcmp(args[i], "--") && ft_strchr(args[i] + 1, letter))
+			return (true);
+	}
+	return (false);
+}
+
+/**
+ * @brief Runs the external program for options a builtin does not know.
+ *
+ * The program gets the streams of the I/O context and is waited for.
+ *
+ * @param cmd The command.
+ * @param io I/O context of the builtin.
+ * @param shell Pointer to the shell structure.
+ * @return The exit status of the program, or 126/127 if it cannot run.
+ */
+int	builtin_external(t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	t_fd_map	map;
+	t_stage		stage;
+	int			status;
+
+	status = resolve_executable(cmd->cmd_args[0], &cmd->exec_path, shell);
+	if (status != EXIT_SUCCESS)
+		return (status);
+	init_fd_map(&map, NULL);
+	map.fds[STDIN_FILENO] = io->in;
+	map.fds[STDOUT_FILENO] = io->out;
+	map.fds[STDERR_FILENO] = io->err;
+	stage = spawn_program(cmd, &map, shell);
+	if (stage.pid == 0)
+		return (stage.status);
+	wait_for_child(stage.pid, &status, shell);
+	return (handle_exit_signal(status, NULL, shell));
+}
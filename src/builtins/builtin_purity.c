@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_purity.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:23:56 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:23:56 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a builtin call leaves the shell state untouched.
+ *
+ * Such a call only reads the shell state (or files, for `cat` and `tee`)
+ * and writes to stdout (and files), so it can run inside the shell instead
+ * of a forked copy without any visible difference. `echo`, `pwd` and `env`
+ * always qualify; `export`, `hash` and `set` only in their listing forms,
+ * and `cat` and `tee` when they do not need the external program (see
+ * `builtin_operands`). Builtins that change variables, the directory, the
+ * job table or the caches (`cd`, `unset`, `exit`, `jobs`, `wait`, ...)
+ * never do.
+ *
+ * @param cmd The command, with its arguments already expanded.
+ * @return true if the command is a state-free builtin call.
+ */
+bool	is_pure_builtin(t_cmd *cmd)
+{
+	char	*name;
+	char	*arg;
+
+	name = cmd->cmd_args[0];
+	if (!name)
+		return (false);
+	arg = cmd->cmd_args[1];
+	if (!ft_strcmp(name, "echo") || !ft_strcmp(name, "pwd")
+		|| !ft_strcmp(name, "env"))
+		return (true);
+	if (!ft_strcmp(name, "export") || !ft_strcmp(name, "hash"))
+		return (arg == NULL);
+	if (!ft_strcmp(name, "cat"))
+		return (builtin_operands(cmd->cmd_args, "u") != -1);
+	if (!ft_strcmp(name, "tee"))
+		return (builtin_operands(cmd->cmd_args, "a") != -1);
+	if (!ft_strcmp(name, "set"))
+		return (!arg || ((!ft_strcmp(arg, "-o") || !ft_strcmp(arg, "+o"))
+				&& !cmd->cmd_args[2]));
+	return (false);
+}
+
+/**
+ * @brief Tells whether a state-free builtin call reads its input.
+ *
+ * `tee` always does, and `cat` when it has no operand or a `-` operand.
+ *
+ * @param cmd A command accepted by `is_pure_builtin`.
+ * @return true if the call reads its standard input.
+ */
+bool	builtin_reads_input(t_cmd *cmd)
+{
+	int	arg;
+
+	if (!ft_strcmp(cmd->cmd_args[0], "tee"))
+		return (true);
+	if (ft_strcmp(cmd->cmd_args[0], "cat"))
+		return (false);
+	arg = builtin_operands(cmd->cmd_args, "u");
+	if (!cmd->cmd_args[arg])
+		return (true);
+	while (cmd->cmd_args[arg])
+	{
+		if (!ft_strcmp(cmd->cmd_args[arg++], "-"))
+			return (true);
+	}
+	return (false);
+}
@@ -12,6 +12,33 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Fills the second half of the built-in commands array.
+ *
+ * @param commands Pointer to the array of command structures.
+ */
+static void	init_builtins_second(t_bltn_cmd *commands)
+{
+	commands[7].cmd_name = "hash";
+	commands[7].cmd_func = ft_hash;
+	commands[8].cmd_name = "set";
+	commands[8].cmd_func = ft_set;
+	commands[9].cmd_name = "jobs";
+	commands[9].cmd_func = ft_jobs;
+	commands[10].cmd_name = "wait";
+	commands[10].cmd_func = ft_wait;
+	commands[11].cmd_name = "parallel";
+	commands[11].cmd_func = ft_parallel;
+	commands[12].cmd_name = "exec";
+	commands[12].cmd_func = ft_exec;
+	commands[13].cmd_name = "cat";
+	commands[13].cmd_func = ft_cat;
+	commands[14].cmd_name = "tee";
+	commands[14].cmd_func = ft_tee;
+	commands[15].cmd_name = NULL;
+	commands[15].cmd_func = NULL;
+}
+
 /**
  * @brief Initializes the array of built-in commands.
  *
@@ -38,8 +65,7 @@ void	init_builtins(t_bltn_cmd *commands)
 	commands[5].cmd_func = ft_env;
 	commands[6].cmd_name = "exit";
 	commands[6].cmd_func = ft_exit;
-	commands[7].cmd_name = NULL;
-	commands[7].cmd_func = NULL;
+	init_builtins_second(commands);
 }
 
 /**
@@ -59,7 +85,7 @@ void	init_builtins(t_bltn_cmd *commands)
  */
 t_bltn_func	fetch_builtin_cmd(char *command)
 {
-	t_bltn_cmd	commands[8];
+	t_bltn_cmd	commands[NUM_BUILTINS + 1];
 	int			index;
 	int			name_found;
 	t_bltn_func	result_func;
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_cat.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:57:34 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:57:34 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends the rest of a descriptor to an output buffer.
+ *
+ * Used when the output of `cat` is captured by a command substitution
+ * and never reaches a descriptor.
+ *
+ * @param fd Descriptor to read from.
+ * @param buf Output buffer of the builtin.
+ * @param shell Pointer to the shell structure for memory management.
+ * @return 0 on success, or -1 on a read error or a ^C.
+ */
+static int	read_to_buffer(int fd, t_outbuf *buf, t_shell *shell)
+{
+	char	chunk[COPY_BUF_SIZE];
+	ssize_t	len;
+
+	len = 1;
+	while (len != 0)
+	{
+		len = read(fd, chunk, COPY_BUF_SIZE);
+		if (sigint_received() || (len == -1 && errno != EINTR))
+			return (-1);
+		if (len > 0)
+			outbuf_add(buf, chunk, len, shell);
+	}
+	return (0);
+}
+
+/**
+ * @brief Copies one input of `cat` to its output.
+ *
+ * A reader that went away ends `cat` quietly, with the status a program
+ * killed by SIGPIPE would have had; a ^C ends it as if killed by SIGINT.
+ *
+ * @param fd Descriptor of the input.
+ * @param name Name of the input, for error messages.
+ * @param io I/O context of the builtin.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, EXIT_FAILURE on an I/O error, or 128 plus the
+ * number of the signal that stopped the copy.
+ */
+static int	cat_fd(int fd, char *name, t_io *io, t_shell *shell)
+{
+	int		result;
+	int		err;
+	char	*cause;
+
+	if (io->captured)
+		result = read_to_buffer(fd, &io->buf, shell);
+	else
+		result = copy_fd_contents(fd, io->out);
+	if (result == 0)
+		return (EXIT_SUCCESS);
+	if (errno == EINTR)
+		return (128 + SIGINT);
+	err = errno;
+	shell->broken_pipe = (err == EPIPE);
+	if (err == EPIPE)
+		return (128 + SIGPIPE);
+	cause = strjoin_tracked("cat: ", name, COMMAND_TRACK, shell);
+	errno = err;
+	return (error_msg_errno(cause, shell));
+}
+
+/**
+ * @brief Copies a file operand of `cat`, or its input for `-`.
+ *
+ * @param name The operand.
+ * @param io I/O context of the builtin.
+ * @param shell Pointer to the shell structure.
+ * @return The status of the copy (see `cat_fd`).
+ */
+static int	cat_operand(char *name, t_io *io, t_shell *shell)
+{
+	int	fd;
+	int	status;
+
+	if (!ft_strcmp(name, "-"))
+		return (cat_fd(io->in, name, io, shell));
+	fd = open(name, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return (error_msg_errno(strjoin_tracked("cat: ", name, COMMAND_TRACK,
+					shell), shell));
+	status = cat_fd(fd, name, io, shell);
+	close(fd);
+	return (status);
+}
+
+/**
+ * @brief Concatenates files to the output without starting a program.
+ *
+ * The data is moved by `copy_fd_contents`, so a file copied to a file or
+ * a pipe never goes through user space. Operands are read in order, `-`
+ * (or no operand) standing for the input; an unreadable operand is
+ * reported and skipped. `-u` is accepted and ignored, as output is never
+ * buffered; any other option is left to the external `cat`.
+ *
+ * SIGPIPE is ignored while the shell itself copies, so that a reader that
+ * goes away stops the builtin instead of the shell, and SIGINT is caught
+ * (see `catch_sigint`), so that ^C stops it.
+ *
+ * @param cmd The command with its operands.
+ * @param io I/O context of the builtin.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, EXIT_FAILURE if an operand failed, or 128 plus
+ * the number of the signal that stopped the copy.
+ */
+int	ft_cat(t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	int	arg;
+	int	status;
+	int	result;
+
+	arg = builtin_operands(cmd->cmd_args, "u");
+	if (arg == -1)
+		return (builtin_external(cmd, io, shell));
+	if (!io->captured && io->out == FD_CLOSED)
+		return (error_msg("cat", ": write error: ", strerror(EBADF), shell));
+	if (shell->is_main)
+		conf_signal(SIGPIPE, SIG_IGN);
+	catch_sigint(shell);
+	status = EXIT_SUCCESS;
+	if (!cmd->cmd_args[arg])
+		status = cat_operand("-", io, shell);
+	while (cmd->cmd_args[arg] && status <= EXIT_FAILURE)
+	{
+		result = cat_operand(cmd->cmd_args[arg++], io, shell);
+		if (result != EXIT_SUCCESS)
+			status = result;
+	}
+	if (shell->is_main)
+		conf_signal(SIGPIPE, SIG_DFL);
+	release_sigint(shell);
+	return (status);
+}
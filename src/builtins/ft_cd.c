@@ -127,11 +127,12 @@ static int	process_cd_args(t_cmd *cmd, char **target_dir, t_shell *shell)
  * directory if the "-" argument is used.
  *
  * @param cmd Pointer to the command structure containing the arguments for cd.
+ * @param io I/O context receiving the directory printed by `cd -`.
  * @param shell Pointer to the shell structure for managing environment
  * variables.
  * @return Exit code (EXIT_SUCCESS on success, EXIT_FAILURE on error).
  */
-int	ft_cd(t_cmd *cmd, t_shell *shell)
+int	ft_cd(t_cmd *cmd, t_io *io, t_shell *shell)
 {
 	char	*current_pwd;
 	char	*target_dir;
@@ -149,7 +150,7 @@ int	ft_cd(t_cmd *cmd, t_shell *shell)
 			get_ev_value(get_ev("PWD", shell->ev_list)), shell) != EXIT_SUCCESS)
 		return (EXIT_FAILURE);
 	if (cmd->cmd_args[1] && ft_strcmp(cmd->cmd_args[1], "-") == 0)
-		write_and_track(strjoin_tracked(current_pwd, "\n", COMMAND_TRACK,
-				shell), STDOUT_FILENO, shell);
+		outbuf_append(&io->buf, strjoin_tracked(current_pwd, "\n",
+				COMMAND_TRACK, shell), shell);
 	return (EXIT_SUCCESS);
 }
@@ -117,10 +117,11 @@ static bool	has_flag(char **cmd_args, int *index, char flag)
  * contain the -n flag, it disables the newline output at the end.
  *
  * @param cmd Pointer to the command structure.
+ * @param io I/O context; the output goes to its buffer.
  * @param shell Pointer to the shell data structure.
  * @return EXIT_SUCCESS upon successful execution of the command.
  */
-int	ft_echo(t_cmd *cmd, t_shell *shell)
+int	ft_echo(t_cmd *cmd, t_io *io, t_shell *shell)
 {
 	bool	add_newline;
 	int		i;
@@ -133,12 +134,12 @@ int	ft_echo(t_cmd *cmd, t_shell *shell)
 	while (cmd->cmd_args[i])
 	{
 		processed_arg = process_escape_sequences(cmd->cmd_args[i], shell);
-		write_and_track(processed_arg, STDOUT_FILENO, shell);
+		outbuf_append(&io->buf, processed_arg, shell);
 		if (cmd->cmd_args[i + 1])
-			write_and_track(" ", STDOUT_FILENO, shell);
+			outbuf_add(&io->buf, " ", 1, shell);
 		i++;
 	}
 	if (add_newline)
-		write_and_track("\n", STDOUT_FILENO, shell);
+		outbuf_add(&io->buf, "\n", 1, shell);
 	return (EXIT_SUCCESS);
 }
@@ -17,6 +17,7 @@
  *
  * @param t_cmd *cmd: Pointer to the command structure containing 
  * the arguments.
+ * @param t_io *io: I/O context receiving the listing.
  * @param t_shell *shell: Pointer to the shell structure containing 
  * environment variables.
  *
@@ -33,7 +34,7 @@
  * displayed successfully, or `EXIT_FAILURE`
  * if there are more arguments than expected.
  */
-int	ft_env(t_cmd *cmd, t_shell *shell)
+int	ft_env(t_cmd *cmd, t_io *io, t_shell *shell)
 {
 	int	arg_count;
 
@@ -48,6 +49,6 @@ int	ft_env(t_cmd *cmd, t_shell *shell)
 		error_msg("env: ", NULL, "more arguments than expected", shell);
 		return (EXIT_FAILURE);
 	}
-	display_ev_list(false, shell->ev_list, shell);
+	display_ev_list(false, shell->ev_list, &io->buf, shell);
 	return (EXIT_SUCCESS);
 }
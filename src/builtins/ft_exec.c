@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_exec.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:49:19 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:49:19 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Implements the `exec` builtin.
+ *
+ * Without arguments it does nothing: its redirections, already applied to
+ * the shell for good (see `exec_redirections`), are all it does. With a
+ * command, the shell process is replaced by the program, without a fork;
+ * the shell's own descriptors are close-on-exec and do not reach it.
+ *
+ * @param cmd The command; its arguments after `exec` are the program.
+ * @param io I/O context (unused).
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS without a command; otherwise only returns if the
+ * program could not be executed, with status 126 or 127.
+ */
+int	ft_exec(t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	t_cmd	program;
+	int		status;
+
+	(void)io;
+	if (!cmd->cmd_args[1])
+		return (EXIT_SUCCESS);
+	ft_bzero(&program, sizeof(t_cmd));
+	program.cmd_args = cmd->cmd_args + 1;
+	status = resolve_executable(program.cmd_args[0], &program.exec_path,
+			shell);
+	if (status != EXIT_SUCCESS)
+		return (status);
+	signals_child(shell);
+	execve(program.exec_path, program.cmd_args, get_ev_array(shell));
+	status = 126;
+	if (errno == ENOENT)
+		status = 127;
+	error_msg_errno(program.cmd_args[0], shell);
+	if (shell->is_main)
+		signals_ignore();
+	return (status);
+}
+
+/**
+ * @brief Runs `exec` with its redirections.
+ *
+ * Unlike any other command, `exec` applies its fd map to the shell itself
+ * and never restores it, so `exec >> run.log 2>&1` opens the log once for
+ * all the commands that follow instead of once per command.
+ *
+ * @param cmd The `exec` command.
+ * @param map Fd map of its redirections; it is released.
+ * @param shell Pointer to the shell structure.
+ * @return The status of `exec`.
+ */
+int	exec_redirections(t_cmd *cmd, t_fd_map *map, t_shell *shell)
+{
+	t_fd_step	steps[FD_MAP_SIZE];
+	t_io		io;
+
+	apply_fd_steps(map, steps, schedule_fd_map(map, steps, shell), shell);
+	release_fd_map(map);
+	init_io(&io, NULL);
+	return (run_builtin(ft_exec, cmd, &io, shell));
+}
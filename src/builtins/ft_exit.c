@@ -126,16 +126,18 @@ static int	parse_exit_arguments(t_cmd *cmd, long long *num,
  * command logic.
  *
  * @param cmd The command structure containing arguments.
+ * @param io I/O context (unused).
  * @param shell The shell context.
  * @return The exit status if there are too many arguments,
  * otherwise exits the shell.
  */
-int	ft_exit(t_cmd *cmd, t_shell *shell)
+int	ft_exit(t_cmd *cmd, t_io *io, t_shell *shell)
 {
 	long long	num;
 	int			exit_status;
 	int			error_status;
 
+	(void)io;
 	if (!cmd->cmd_args[1])
 		clean_exit(0, shell);
 	if (ft_strcmp(cmd->cmd_args[1], "--") == 0)
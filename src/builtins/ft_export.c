@@ -118,6 +118,8 @@ static void	process_export(char *ev_str, bool *has_invalid_name, t_shell *shell)
  *
  * @param t_cmd *cmd: Pointer to the command structure containing the 
  * arguments.
+ * @param t_io *io: I/O context receiving the listing printed without
+ * arguments.
  * @param t_shell *shell: Pointer to the shell structure containing 
  * environment variables.
  *
@@ -132,14 +134,14 @@ static void	process_export(char *ev_str, bool *has_invalid_name, t_shell *shell)
  * if any variable names are invalid.
  */
 
-int	ft_export(t_cmd *cmd, t_shell *shell)
+int	ft_export(t_cmd *cmd, t_io *io, t_shell *shell)
 {
 	bool	has_invalid_name;
 	char	**args;
 
 	args = cmd->cmd_args + 1;
 	if (!*args)
-		return (display_ev_list(true, shell->ev_list, shell));
+		return (display_ev_list(true, shell->ev_list, &io->buf, shell));
 	has_invalid_name = false;
 	while (*args)
 	{
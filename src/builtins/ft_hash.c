@@ -0,0 +1,160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hash.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:52:04 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:52:04 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends the remembered path of a name, as printed by `hash -t`.
+ *
+ * @param name Name to print before the path, or NULL.
+ * @param node Node of the name in the table.
+ * @param io I/O context receiving the line.
+ * @param shell Pointer to the shell structure.
+ */
+static void	append_hashed(char *name, t_list *node, t_io *io, t_shell *shell)
+{
+	if (name)
+	{
+		outbuf_append(&io->buf, name, shell);
+		outbuf_add(&io->buf, "\t", 1, shell);
+	}
+	outbuf_append(&io->buf, ((t_hash_entry *)node->content)->path, shell);
+	outbuf_add(&io->buf, "\n", 1, shell);
+}
+
+/**
+ * @brief Handles `hash -d` and `hash -t` for a list of names.
+ *
+ * `-d` forgets each name; `-t` prints the remembered path of each name
+ * (prefixed by the name when several are given).
+ *
+ * @param option The option, "-d" or "-t".
+ * @param names NULL-terminated list of command names.
+ * @param io I/O context receiving the paths printed by `-t`.
+ * @param shell Pointer to the shell structure holding the table.
+ * @return EXIT_SUCCESS, EXIT_FAILURE if a name is not hashed, or 2 on a
+ * missing argument.
+ */
+static int	hash_query(char *option, char **names, t_io *io, t_shell *shell)
+{
+	int		status;
+	t_list	*node;
+	bool	show_name;
+
+	if (!*names)
+		return (error_msg("hash: ", option, ": option requires an argument",
+				shell), 2);
+	status = EXIT_SUCCESS;
+	show_name = (names[1] != NULL);
+	while (*names)
+	{
+		node = hash_find(*names, shell);
+		if (!node)
+			status = error_msg("hash: ", *names, ": not found", shell);
+		else if (option[1] == 'd')
+			hash_remove(*names, shell);
+		else if (show_name)
+			append_hashed(*names, node, io, shell);
+		else
+			append_hashed(NULL, node, io, shell);
+		names++;
+	}
+	return (status);
+}
+
+/**
+ * @brief Handles `hash -p path name...`.
+ *
+ * Every name is bound to the given path without searching PATH.
+ *
+ * @param args Arguments following `-p`: the path, then command names.
+ * @param shell Pointer to the shell structure holding the table.
+ * @return EXIT_SUCCESS, or 2 if the path or the names are missing.
+ */
+static int	hash_set_path(char **args, t_shell *shell)
+{
+	char	*path;
+
+	if (!args[0] || !args[1])
+		return (error_msg("hash: -p", NULL, ": option requires an argument",
+				shell), 2);
+	path = *args++;
+	while (*args)
+		hash_store(*args++, path, 0, shell);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Searches PATH for each name and remembers the result.
+ *
+ * Names containing a slash and builtin names are skipped, as in bash.
+ *
+ * @param names NULL-terminated list of command names.
+ * @param shell Pointer to the shell structure holding the table.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if a name was not found.
+ */
+static int	hash_add_names(char **names, t_shell *shell)
+{
+	int		status;
+	char	*path;
+	bool	access_error;
+
+	status = EXIT_SUCCESS;
+	while (*names)
+	{
+		if (!ft_strchr(*names, '/') && !fetch_builtin_cmd(*names))
+		{
+			path = search_path(*names, &access_error, shell);
+			if (path)
+				hash_store(*names, path, 0, shell);
+			else
+				status = error_msg("hash: ", *names, ": not found", shell);
+		}
+		names++;
+	}
+	return (status);
+}
+
+/**
+ * @brief Implements the `hash` builtin.
+ *
+ * Without arguments, lists the remembered commands with their hit counts.
+ * `-r` empties the table (and the cache of missing commands), `-d` forgets
+ * names, `-t` prints remembered paths, `-p path name` binds a name to a
+ * path, and plain names are looked up in PATH and remembered.
+ *
+ * @param cmd Pointer to the command structure containing the arguments.
+ * @param io I/O context of the builtin.
+ * @param shell Pointer to the shell structure holding the table.
+ * @return The exit status of the builtin.
+ */
+int	ft_hash(t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	char	**args;
+
+	args = cmd->cmd_args + 1;
+	if (!*args)
+		return (print_hash_table(io, shell));
+	if (ft_strcmp(*args, "-r") == 0)
+	{
+		hash_reset(shell);
+		neg_cache_clear(shell);
+		args++;
+	}
+	else if (ft_strcmp(*args, "-d") == 0 || ft_strcmp(*args, "-t") == 0)
+		return (hash_query(*args, args + 1, io, shell));
+	else if (ft_strcmp(*args, "-p") == 0)
+		return (hash_set_path(args + 1, shell));
+	else if (**args == '-' && (*args)[1])
+		return (error_msg("hash: ", *args, ": invalid option", shell), 2);
+	return (hash_add_names(args, shell));
+}
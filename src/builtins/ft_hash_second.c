@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_hash_second.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:52:04 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:52:04 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends one `hits<TAB>command` line to the listing buffer.
+ *
+ * The hit counter is right-aligned on four columns, as bash prints it.
+ *
+ * @param entry Hash table entry to format.
+ * @param out Output buffer receiving the line.
+ * @param shell Pointer to the shell structure for memory management.
+ */
+static void	append_hash_line(t_hash_entry *entry, t_outbuf *out,
+		t_shell *shell)
+{
+	char	*hits;
+	int		padding;
+
+	hits = manage_memory(ft_itoa(entry->hits), COMMAND_TRACK, shell);
+	padding = 4 - (int)ft_strlen(hits);
+	while (padding-- > 0)
+		outbuf_append(out, " ", shell);
+	outbuf_append(out, hits, shell);
+	outbuf_append(out, "\t", shell);
+	outbuf_append(out, entry->path, shell);
+	outbuf_append(out, "\n", shell);
+}
+
+/**
+ * @brief Prints the command hash table.
+ *
+ * @param io I/O context receiving the listing.
+ * @param shell Pointer to the shell structure holding the table.
+ * @return EXIT_SUCCESS.
+ */
+int	print_hash_table(t_io *io, t_shell *shell)
+{
+	t_list	*node;
+	size_t	start;
+	int		i;
+
+	hash_sync(shell);
+	start = io->buf.len;
+	outbuf_append(&io->buf, "hits\tcommand\n", shell);
+	i = 0;
+	while (i < HASH_BUCKETS)
+	{
+		node = shell->cmd_hash[i++];
+		while (node)
+		{
+			append_hash_line((t_hash_entry *)node->content, &io->buf, shell);
+			node = node->next;
+		}
+	}
+	if (io->buf.len == start + ft_strlen("hits\tcommand\n"))
+	{
+		io->buf.len = start;
+		outbuf_append(&io->buf, "hash: hash table empty\n", shell);
+	}
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_jobs.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:12:39 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:12:39 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Describes the state of a job, as in bash.
+ *
+ * @param job The job.
+ * @param shell Pointer to the shell structure for memory management.
+ * @return "Running", "Done", "Exit N", or the description of the signal
+ * that killed the job.
+ */
+static char	*job_state(t_job *job, t_shell *shell)
+{
+	char	*code;
+
+	if (!job->done)
+		return ("Running");
+	if (WIFSIGNALED(job->status))
+		return (strsignal(WTERMSIG(job->status)));
+	if (job_exit_code(job->status) == EXIT_SUCCESS)
+		return ("Done");
+	code = manage_memory(ft_itoa(job_exit_code(job->status)), COMMAND_TRACK,
+			shell);
+	return (strjoin_tracked("Exit ", code, COMMAND_TRACK, shell));
+}
+
+/**
+ * @brief Appends the listing line of a job to an output buffer.
+ *
+ * The line has the form `[N]+  State                   command`, with
+ * ` &` after the command of a running job.
+ *
+ * @param node Node of the job in the job table.
+ * @param out Output buffer receiving the line.
+ * @param shell Pointer to the shell structure for memory management.
+ */
+void	format_job(t_list *node, t_outbuf *out, t_shell *shell)
+{
+	t_job	*job;
+	char	*state;
+	char	*id;
+	size_t	width;
+	char	marker[5];
+
+	job = (t_job *)node->content;
+	id = manage_memory(ft_itoa(job->id), COMMAND_TRACK, shell);
+	outbuf_append(out, "[", shell);
+	outbuf_append(out, id, shell);
+	ft_strlcpy(marker, "]   ", sizeof(marker));
+	marker[1] = job_marker(node);
+	outbuf_append(out, marker, shell);
+	state = job_state(job, shell);
+	outbuf_append(out, state, shell);
+	width = ft_strlen(state);
+	outbuf_add(out, " ", 1, shell);
+	while (++width < JOB_STATE_WIDTH)
+		outbuf_add(out, " ", 1, shell);
+	outbuf_append(out, job->text, shell);
+	if (!job->done)
+		outbuf_append(out, " &", shell);
+	outbuf_append(out, "\n", shell);
+}
+
+/**
+ * @brief Appends the PID of a job to an output buffer.
+ *
+ * @param job The job.
+ * @param out Output buffer receiving the line.
+ * @param shell Pointer to the shell structure for memory management.
+ */
+static void	format_job_pid(t_job *job, t_outbuf *out, t_shell *shell)
+{
+	outbuf_append(out, manage_memory(ft_itoa(job->pid), COMMAND_TRACK, shell),
+		shell);
+	outbuf_append(out, "\n", shell);
+}
+
+/**
+ * @brief Implements the `jobs` builtin.
+ *
+ * Lists the background jobs with their state, or only their PIDs with
+ * `-p`. Jobs reported as finished are removed from the table.
+ *
+ * @param cmd Pointer to the command structure containing the arguments.
+ * @param io I/O context receiving the listing.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, or 2 on an invalid option.
+ */
+int	ft_jobs(t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	t_list	*node;
+	t_list	*next;
+	bool	pids_only;
+
+	pids_only = (cmd->cmd_args[1] && !ft_strcmp(cmd->cmd_args[1], "-p"));
+	if (cmd->cmd_args[1] && !pids_only)
+		return (error_msg("jobs: ", cmd->cmd_args[1], ": invalid option",
+				shell), 2);
+	refresh_jobs(shell);
+	node = shell->jobs;
+	while (node)
+	{
+		next = node->next;
+		if (pids_only)
+			format_job_pid((t_job *)node->content, &io->buf, shell);
+		else
+			format_job(node, &io->buf, shell);
+		if (((t_job *)node->content)->done)
+			del_node(&node, &shell->jobs, free_job, true);
+		node = next;
+	}
+	return (EXIT_SUCCESS);
+}
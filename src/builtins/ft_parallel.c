@@ -0,0 +1,171 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_parallel.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:17:08 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:17:08 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Converts the argument of `-j` to a number of jobs.
+ *
+ * @param str Argument of the option.
+ * @return The number of jobs, or -1 if `str` is not a positive number.
+ */
+static int	parse_job_count(char *str)
+{
+	int	i;
+
+	i = 0;
+	while (str && ft_isdigit(str[i]))
+		i++;
+	if (!str || i == 0 || str[i] || i > 6 || ft_atoi(str) == 0)
+		return (-1);
+	return (ft_atoi(str));
+}
+
+/**
+ * @brief Parses the options of `parallel`.
+ *
+ * `-j N` (or `-jN`) sets the number of jobs run at once; it defaults to
+ * the number of online CPUs. `--` ends the options.
+ *
+ * @param args Arguments of the builtin.
+ * @param par Runner whose `max_jobs` is set.
+ * @param shell Pointer to the shell structure.
+ * @return Index of the first word of the template, or -1 after an error.
+ */
+static int	parse_options(char **args, t_parallel *par, t_shell *shell)
+{
+	char	*num;
+	int		i;
+
+	par->max_jobs = ft_max((int)sysconf(_SC_NPROCESSORS_ONLN), 1);
+	i = 1;
+	while (args[i] && !ft_strncmp(args[i], "-j", 2))
+	{
+		num = args[i] + 2;
+		if (!*num)
+			num = args[++i];
+		par->max_jobs = parse_job_count(num);
+		if (par->max_jobs == -1 && !num)
+			return (error_msg("parallel: -j: ", NULL,
+					"option requires an argument", shell), -1);
+		if (par->max_jobs == -1)
+			return (error_msg("parallel: ", num, ": invalid job count",
+					shell), -1);
+		i++;
+	}
+	if (args[i] && !ft_strcmp(args[i], "--"))
+		i++;
+	return (i);
+}
+
+/**
+ * @brief Reads the inputs of the jobs from stdin, one per line.
+ *
+ * Empty lines are skipped. A ^C stops the reading.
+ *
+ * @param fd Input of the builtin.
+ * @param shell Pointer to the shell structure.
+ * @return NULL-terminated array of inputs.
+ */
+static char	**read_inputs(int fd, t_shell *shell)
+{
+	char		chunk[COPY_BUF_SIZE];
+	t_outbuf	buf;
+	ssize_t		len;
+
+	ft_bzero(&buf, sizeof(buf));
+	outbuf_add(&buf, "", 0, shell);
+	len = 1;
+	while (len != 0)
+	{
+		len = read(fd, chunk, sizeof(chunk));
+		if (len == -1 && g_signal == SIGINT)
+			break ;
+		if (len == -1 && errno != EINTR)
+		{
+			error_msg_errno("parallel: stdin", shell);
+			break ;
+		}
+		if (len > 0)
+			outbuf_add(&buf, chunk, len, shell);
+	}
+	return (split_tracked(buf.data, '\n', COMMAND_TRACK, shell));
+}
+
+/**
+ * @brief Splits the words of `parallel` into the template and the inputs.
+ *
+ * The inputs follow `:::`; globs among them have already been expanded
+ * by the shell. Without `:::`, they are read from stdin.
+ *
+ * @param words Words following the options.
+ * @param par Runner to fill, with its I/O context.
+ * @param shell Pointer to the shell structure.
+ */
+static void	split_template(char **words, t_parallel *par, t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (words[i] && ft_strcmp(words[i], ":::"))
+		i++;
+	par->tmpl = words;
+	par->tmpl_len = i;
+	if (words[i])
+		par->inputs = words + i + 1;
+	else
+		par->inputs = read_inputs(par->io->in, shell);
+	par->count = 0;
+	while (par->inputs[par->count])
+		par->count++;
+}
+
+/**
+ * @brief Implements the `parallel` builtin.
+ *
+ * `parallel [-j N] command [arg...] [::: input...]` runs the command once
+ * per input, at most N at a time. Each `{}` in the template is replaced by
+ * the input, which is appended as the last argument if there is no `{}`.
+ * The output of every job is printed in one piece when it ends, and the
+ * exit status of every job is kept in PIPESTATUS, in input order.
+ * ^C stops the reading of the inputs and the launching of jobs.
+ *
+ * @param cmd Pointer to the command structure containing the arguments.
+ * @param io I/O context: inputs are read from it and the output of the
+ * jobs is copied to it.
+ * @param shell Pointer to the shell structure.
+ * @return 0 if every job succeeded, the number of failed jobs (at most
+ * 101) otherwise, 2 on a usage error, 126/127 if the command cannot
+ * be executed, or 130 after a ^C.
+ */
+int	ft_parallel(t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	t_parallel	par;
+	int			start;
+	int			status;
+
+	ft_bzero(&par, sizeof(par));
+	par.io = io;
+	start = parse_options(cmd->cmd_args, &par, shell);
+	if (start == -1)
+		return (2);
+	if (!cmd->cmd_args[start] || !ft_strcmp(cmd->cmd_args[start], ":::"))
+		return (error_msg("parallel: usage: ", NULL,
+				"parallel [-j N] command [arg...] [::: input...]", shell), 2);
+	catch_sigint(shell);
+	split_template(cmd->cmd_args + start, &par, shell);
+	status = 128 + SIGINT;
+	if (g_signal != SIGINT)
+		status = run_parallel(&par, shell);
+	release_sigint(shell);
+	return (status);
+}
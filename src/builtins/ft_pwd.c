@@ -12,7 +12,7 @@
 
 #include "minishell.h"
 
-int	ft_pwd(t_cmd *cmd, t_shell *shell)
+int	ft_pwd(t_cmd *cmd, t_io *io, t_shell *shell)
 {
 	t_list	*pwd_ev;
 	char	*pwd_value;
@@ -22,7 +22,7 @@ int	ft_pwd(t_cmd *cmd, t_shell *shell)
 	pwd_ev = get_ev("PWD", shell->ev_list);
 	pwd_value = get_ev_value(pwd_ev);
 	if (pwd_value)
-		write_and_track(pwd_value, STDOUT_FILENO, shell);
+		outbuf_append(&io->buf, pwd_value, shell);
 	else
 	{
 		dir_path = getcwd(NULL, 0);
@@ -32,9 +32,9 @@ int	ft_pwd(t_cmd *cmd, t_shell *shell)
 			return (EXIT_FAILURE);
 		}
 		manage_memory(dir_path, COMMAND_TRACK, shell);
-		write_and_track(dir_path, STDOUT_FILENO, shell);
+		outbuf_append(&io->buf, dir_path, shell);
 	}
-	write_and_track("\n", STDOUT_FILENO, shell);
+	outbuf_add(&io->buf, "\n", 1, shell);
 	return (EXIT_SUCCESS);
 }
 
@@ -43,6 +43,7 @@ int	ft_pwd(t_cmd *cmd, t_shell *shell)
  *
  * @param t_cmd *cmd: Pointer to the command structure containing 
  * the command and its arguments (not used in this function).
+ * @param t_io *io: I/O context receiving the directory.
  * @param t_shell *shell: Pointer to the shell structure representing 
  * the current state of the shell, including the environment variable list.
  *
@@ -59,8 +60,8 @@ int	ft_pwd(t_cmd *cmd, t_shell *shell)
  * using the `get_ev_value` function.
  * 
  * 3. Print "PWD" Value if Available:
- *    - If the "PWD" value is available, print it to the standard 
- * output using the `write_and_track` function.
+ *    - If the "PWD" value is available, append it to the output 
+ * buffer of the I/O context.
  * 
  * 4. Get and Print Current Directory if "PWD" Not Available:
  *    - If the "PWD" value is not available, use `getcwd` to get the 
@@ -68,11 +69,10 @@ int	ft_pwd(t_cmd *cmd, t_shell *shell)
  *    - If `getcwd` fails, handle the error using `exit_on_sys_error` 
  * and return `EXIT_FAILURE`.
  *    - If successful, manage the memory for the directory path using 
- * `manage_memory` and print it to the standard output.
+ * `manage_memory` and append it to the output buffer.
  * 
  * 5. Print Newline:
- *    - Print a newline character to the standard output using 
- * `write_and_track`.
+ *    - Append a newline character to the output buffer.
  * 
  * 6. Return Success:
  *    - Return `EXIT_SUCCESS`, indicating that the `pwd` operation 
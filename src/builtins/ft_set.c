@@ -0,0 +1,91 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_set.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:08:04 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:08:04 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Prints the state of the shell options.
+ *
+ * @param reusable Whether to print the options as `set` commands (`set +o`)
+ * instead of a name/state table (`set -o`).
+ * @param out Buffer receiving the listing.
+ * @param shell Pointer to the shell structure holding the options.
+ * @return EXIT_SUCCESS.
+ */
+static int	print_options(bool reusable, t_outbuf *out, t_shell *shell)
+{
+	if (reusable && shell->pipefail)
+		outbuf_append(out, "set -o pipefail\n", shell);
+	else if (reusable)
+		outbuf_append(out, "set +o pipefail\n", shell);
+	else if (shell->pipefail)
+		outbuf_append(out, "pipefail       \ton\n", shell);
+	else
+		outbuf_append(out, "pipefail       \toff\n", shell);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Handles `-o name` and `+o name`.
+ *
+ * `-o` enables the option and `+o` disables it. Without a name, the options
+ * are listed.
+ *
+ * @param flag "-o" or "+o".
+ * @param name Name of the option, or NULL.
+ * @param io I/O context receiving the listing when `name` is NULL.
+ * @param shell Pointer to the shell structure holding the options.
+ * @return EXIT_SUCCESS, or 2 for an unknown option name.
+ */
+static int	set_option(char *flag, char *name, t_io *io, t_shell *shell)
+{
+	if (!name)
+		return (print_options(flag[0] == '+', &io->buf, shell));
+	if (ft_strcmp(name, "pipefail") != 0)
+		return (error_msg("set: ", name, ": invalid option name", shell), 2);
+	shell->pipefail = (flag[0] == '-');
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Implements the `set` builtin.
+ *
+ * Without arguments, lists the variables. `set -o pipefail` makes the
+ * status of a pipeline the status of its rightmost failed stage, and
+ * `set +o pipefail` restores the default (status of the last stage).
+ * `set -o` and `set +o` list the options.
+ *
+ * @param cmd Pointer to the command structure containing the arguments.
+ * @param io I/O context of the builtin.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, or 2 on an invalid option.
+ */
+int	ft_set(t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	char	**args;
+	int		status;
+
+	args = cmd->cmd_args + 1;
+	if (!*args)
+		return (display_ev_list(false, shell->ev_list, &io->buf, shell));
+	status = EXIT_SUCCESS;
+	while (*args && status == EXIT_SUCCESS)
+	{
+		if (ft_strcmp(*args, "-o") && ft_strcmp(*args, "+o"))
+			return (error_msg("set: ", *args, ": invalid option", shell), 2);
+		status = set_option(args[0], args[1], io, shell);
+		if (args[1])
+			args++;
+		args++;
+	}
+	return (status);
+}
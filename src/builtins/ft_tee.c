@@ -0,0 +1,153 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_tee.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:02:53 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 01:02:53 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+
+/**
+ * @brief Copies the input to the output and the files through a buffer.
+ *
+ * Used when the input is not a pipe, which `tee(2)` cannot duplicate.
+ *
+ * @param ctx The tee context.
+ * @return 0 at the end of the input, or -1 on an error or a ^C.
+ */
+static int	tee_buffered(t_tee *ctx)
+{
+	char	buf[COPY_BUF_SIZE];
+	ssize_t	len;
+	int		i;
+
+	len = 1;
+	while (len != 0)
+	{
+		ctx->failed = NULL;
+		len = read(ctx->in, buf, COPY_BUF_SIZE);
+		if (sigint_received() || (len == -1 && errno != EINTR))
+			return (-1);
+		ctx->failed = "standard output";
+		if (len > 0 && write_all(ctx->out, buf, len) == -1)
+			return (-1);
+		i = -1;
+		while (len > 0 && ++i < ctx->count)
+		{
+			ctx->failed = ctx->names[i];
+			if (write_all(ctx->files[i], buf, len) == -1)
+				return (-1);
+		}
+	}
+	return (0);
+}
+
+
+/**
+ * @brief Copies the input of `tee` to its output and files.
+ *
+ * Without files, this is a plain copy (see `copy_fd_contents`). With a
+ * pipe as input, the data is fanned out in the kernel by `tee_spliced`;
+ * otherwise it goes through `tee_buffered`. A reader that went away ends
+ * the copy quietly, with the status a program killed by SIGPIPE would
+ * have had; a ^C ends it as if killed by SIGINT.
+ *
+ * @param ctx The tee context, with its files open.
+ * @param shell Pointer to the shell structure.
+ * @return The status of the builtin.
+ */
+static int	copy_tee(t_tee *ctx, t_shell *shell)
+{
+	int	result;
+
+	ctx->failed = NULL;
+	if (ctx->count == 0)
+		result = copy_fd_contents(ctx->in, ctx->out);
+	else if (open_spare(ctx))
+	{
+		result = tee_spliced(ctx);
+		close_spare(ctx);
+	}
+	else
+		result = tee_buffered(ctx);
+	if (result == 0)
+		return (EXIT_SUCCESS);
+	if (errno == EINTR)
+		return (128 + SIGINT);
+	shell->broken_pipe = (errno == EPIPE);
+	if (errno == EPIPE)
+		return (128 + SIGPIPE);
+	if (!ctx->failed)
+		return (error_msg_errno("tee", shell));
+	return (error_msg_errno(strjoin_tracked("tee: ", ctx->failed,
+				COMMAND_TRACK, shell), shell));
+}
+
+/**
+ * @brief Runs the copy of `tee` with the signal dispositions it needs.
+ *
+ * SIGPIPE is ignored while the shell itself copies, so that a reader that
+ * goes away stops the builtin instead of the shell, and SIGINT is caught
+ * (see `catch_sigint`), so that ^C stops it. The files are closed once
+ * the copy is over.
+ *
+ * @param ctx The tee context, with its files open.
+ * @param shell Pointer to the shell structure.
+ * @return The status of the copy (see `copy_tee`).
+ */
+static int	run_tee(t_tee *ctx, t_shell *shell)
+{
+	int	status;
+
+	if (shell->is_main)
+		conf_signal(SIGPIPE, SIG_IGN);
+	catch_sigint(shell);
+	status = copy_tee(ctx, shell);
+	while (ctx->count > 0)
+		close(ctx->files[--ctx->count]);
+	if (shell->is_main)
+		conf_signal(SIGPIPE, SIG_DFL);
+	release_sigint(shell);
+	return (status);
+}
+
+/**
+ * @brief Copies the input to the output and to files, without a program.
+ *
+ * When the input is a pipe, as in `cmd | tee log | next`, the data is
+ * duplicated with `tee(2)` and written out with `splice(2)`, so it never
+ * enters user space. `-a` appends to the files; any other option is left
+ * to the external `tee`.
+ *
+ * @param cmd The command with its file operands.
+ * @param io I/O context of the builtin.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, EXIT_FAILURE if a file failed, or 128 plus the
+ * number of the signal that stopped the copy.
+ */
+int	ft_tee(t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	t_tee	ctx;
+	int		arg;
+	int		status;
+	int		flags;
+
+	arg = builtin_operands(cmd->cmd_args, "a");
+	if (arg == -1)
+		return (builtin_external(cmd, io, shell));
+	if (io->out == FD_CLOSED)
+		return (error_msg("tee", ": write error: ", strerror(EBADF), shell));
+	flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+	if (builtin_has_option(cmd->cmd_args, arg, 'a'))
+		flags = O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC;
+	ctx.in = io->in;
+	ctx.out = io->out;
+	status = open_tee_files(&ctx, cmd->cmd_args + arg, flags, shell);
+	return (ft_max(status, run_tee(&ctx, shell)));
+}
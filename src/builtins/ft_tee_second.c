@@ -0,0 +1,161 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_tee_second.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:02:53 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 01:02:53 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Copies exactly `len` bytes through a user-space buffer.
+ *
+ * @param src Descriptor holding at least `len` bytes.
+ * @param dst Descriptor to write to.
+ * @param len Number of bytes to copy; no byte past them is read.
+ * @return 0 on success, or -1 on an error or a ^C.
+ */
+static int	copy_prefix(int src, int dst, size_t len)
+{
+	char	buf[COPY_BUF_SIZE];
+	ssize_t	got;
+	size_t	step;
+
+	while (len > 0)
+	{
+		step = len;
+		if (step > COPY_BUF_SIZE)
+			step = COPY_BUF_SIZE;
+		got = read(src, buf, step);
+		if (got == 0 || sigint_received() || (got == -1 && errno != EINTR))
+			return (-1);
+		if (got > 0 && write_all(dst, buf, got) == -1)
+			return (-1);
+		if (got > 0)
+			len -= got;
+	}
+	return (0);
+}
+
+/**
+ * @brief Moves exactly `len` bytes out of a pipe.
+ *
+ * The bytes are spliced when the destination allows it; a destination
+ * that does not (a terminal, a file opened for appending, ...) gets them
+ * with `copy_prefix`.
+ *
+ * @param src Read end of a pipe holding at least `len` bytes.
+ * @param dst Descriptor to write to.
+ * @param len Number of bytes to move.
+ * @return 0 on success, or -1 on an error or a ^C.
+ */
+static int	drain_pipe(int src, int dst, size_t len)
+{
+	ssize_t	moved;
+
+	while (len > 0)
+	{
+		moved = splice(src, NULL, dst, NULL, len, SPLICE_F_MOVE);
+		if (moved == -1 && errno == EINVAL)
+			return (copy_prefix(src, dst, len));
+		if (moved == 0 || sigint_received() || (moved == -1
+				&& errno != EINTR))
+			return (-1);
+		if (moved > 0)
+			len -= moved;
+	}
+	return (0);
+}
+
+/**
+ * @brief Sends the head of the input to an output through the spare pipe.
+ *
+ * The spare pipe is empty and at least as large as the input pipe, so it
+ * takes the whole chunk that `tee(2)` offers.
+ *
+ * @param ctx The tee context.
+ * @param dst Descriptor to write to.
+ * @param len Size of the chunk at the head of the input.
+ * @return 0 on success, or -1 on an error or a ^C.
+ */
+static int	tee_to_spare(t_tee *ctx, int dst, ssize_t len)
+{
+	ssize_t	copied;
+
+	copied = -1;
+	while (copied == -1)
+	{
+		copied = tee(ctx->in, ctx->tmp[1], len, 0);
+		if (sigint_received() || (copied == -1 && errno != EINTR))
+			return (-1);
+	}
+	if (copied != len)
+	{
+		errno = EIO;
+		return (-1);
+	}
+	return (drain_pipe(ctx->tmp[0], dst, len));
+}
+
+/**
+ * @brief Sends one chunk of the input to every output without copying it.
+ *
+ * `tee(2)` lends the pages at the head of the input pipe to the output
+ * pipe, or to the spare pipe that is then drained into an output that is
+ * not a pipe. It does so again through the spare pipe for each file but
+ * the last one, and the last file consumes the chunk from the input.
+ *
+ * @param ctx The tee context.
+ * @return Size of the chunk, 0 at the end of the input, or -1 on an error.
+ */
+static ssize_t	tee_chunk(t_tee *ctx)
+{
+	ssize_t	len;
+	int		i;
+
+	ctx->failed = "standard output";
+	if (ctx->out_is_pipe)
+		len = tee(ctx->in, ctx->out, COPY_CHUNK, 0);
+	else
+		len = tee(ctx->in, ctx->tmp[1], COPY_CHUNK, 0);
+	if (len > 0 && !ctx->out_is_pipe
+		&& drain_pipe(ctx->tmp[0], ctx->out, len) == -1)
+		return (-1);
+	i = 0;
+	while (len > 0 && i < ctx->count - 1)
+	{
+		ctx->failed = ctx->names[i];
+		if (tee_to_spare(ctx, ctx->files[i], len) == -1)
+			return (-1);
+		i++;
+	}
+	ctx->failed = ctx->names[i];
+	if (len > 0 && drain_pipe(ctx->in, ctx->files[i], len) == -1)
+		return (-1);
+	return (len);
+}
+
+/**
+ * @brief Copies the input pipe to the output and the files, in the kernel.
+ *
+ * @param ctx The tee context, with its spare pipe open if it needs one.
+ * @return 0 at the end of the input, or -1 on an error or a ^C.
+ */
+int	tee_spliced(t_tee *ctx)
+{
+	ssize_t	len;
+
+	len = 1;
+	while (len != 0)
+	{
+		len = tee_chunk(ctx);
+		if (sigint_received() || (len == -1 && errno != EINTR))
+			return (-1);
+	}
+	return (0);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_tee_third.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:19:08 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 01:19:08 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Opens the files of a `tee` command.
+ *
+ * A file that cannot be opened is reported and left out.
+ *
+ * @param ctx The tee context, receiving the open files.
+ * @param names File operands.
+ * @param flags Flags to open them with.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if a file could not be opened.
+ */
+int	open_tee_files(t_tee *ctx, char **names, int flags,
+		t_shell *shell)
+{
+	int	status;
+	int	fd;
+
+	ctx->count = 0;
+	while (names[ctx->count])
+		ctx->count++;
+	ctx->files = calloc_tracked(ctx->count + 1, sizeof(int), COMMAND_TRACK,
+			shell);
+	ctx->names = calloc_tracked(ctx->count + 1, sizeof(char *), COMMAND_TRACK,
+			shell);
+	ctx->count = 0;
+	status = EXIT_SUCCESS;
+	while (*names)
+	{
+		fd = open(*names, flags, 0644);
+		if (fd == -1)
+			status = error_msg_errno(strjoin_tracked("tee: ", *names,
+						COMMAND_TRACK, shell), shell);
+		else
+			ctx->names[ctx->count] = *names;
+		if (fd != -1)
+			ctx->files[ctx->count++] = fd;
+		names++;
+	}
+	return (status);
+}
+
+/**
+ * @brief Checks that the input can be teed and opens the spare pipe.
+ *
+ * The spare pipe carries the chunks meant for the files but the last one,
+ * and for an output that is not a pipe. It is sized like the input pipe,
+ * so that `tee(2)` can always duplicate a whole chunk into it.
+ *
+ * @param ctx The tee context.
+ * @return true if the copy can go through `tee_spliced`.
+ */
+bool	open_spare(t_tee *ctx)
+{
+	struct stat	in;
+	struct stat	out;
+	int			size;
+
+	ctx->tmp[0] = -1;
+	ctx->tmp[1] = -1;
+	if (fstat(ctx->in, &in) == -1 || fstat(ctx->out, &out) == -1
+		|| !S_ISFIFO(in.st_mode))
+		return (false);
+	ctx->out_is_pipe = S_ISFIFO(out.st_mode);
+	if (ctx->out_is_pipe && ctx->count == 1)
+		return (true);
+	size = fcntl(ctx->in, F_GETPIPE_SZ);
+	if (size == -1 || pipe2(ctx->tmp, O_CLOEXEC) == -1)
+		return (false);
+	if (fcntl(ctx->tmp[1], F_SETPIPE_SZ, size) >= size)
+		return (true);
+	close_spare(ctx);
+	return (false);
+}
+
+/**
+ * @brief Closes the spare pipe of `tee`, if it is open.
+ *
+ * `errno` is kept, so the error that ended the copy can still be
+ * reported.
+ *
+ * @param ctx The tee context.
+ */
+void	close_spare(t_tee *ctx)
+{
+	int	err;
+
+	err = errno;
+	if (ctx->tmp[0] != -1)
+		close(ctx->tmp[0]);
+	if (ctx->tmp[1] != -1)
+		close(ctx->tmp[1]);
+	ctx->tmp[0] = -1;
+	ctx->tmp[1] = -1;
+	errno = err;
+}
@@ -12,17 +12,21 @@
 
 #include "minishell.h"
 
-int	ft_unset(t_cmd *cmd, t_shell *shell)
+int	ft_unset(t_cmd *cmd, t_io *io, t_shell *shell)
 {
 	char	**args;
 	t_list	*ev;
 
+	(void)io;
 	args = cmd->cmd_args + 1;
 	while (*args != NULL)
 	{
 		ev = get_ev(*args, shell->ev_list);
 		if (ev != NULL)
+		{
 			del_node(&ev, &(shell->ev_list), free_ev, true);
+			mark_ev_changed(*args, shell);
+		}
 		args++;
 	}
 	return (EXIT_SUCCESS);
@@ -33,6 +37,7 @@ int	ft_unset(t_cmd *cmd, t_shell *shell)
  *
  * @param t_cmd *cmd: Pointer to the command structure containing 
  * the command and its arguments.
+ * @param t_io *io: I/O context (unused).
  * @param t_shell *shell: Pointer to the shell structure representing 
  * the current state of the shell, including the environment variable list.
  *
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   ft_wait.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:13:02 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:13:02 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Waits for every background job and empties the job table.
+ *
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS.
+ */
+static int	wait_all(t_shell *shell)
+{
+	while (shell->jobs)
+	{
+		update_job((t_job *)shell->jobs->content, true, shell);
+		remove_job((t_job *)shell->jobs->content, shell);
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Returns a finished job, if there is one.
+ *
+ * A running job whose process has no pidfd cannot wake up the supervisor,
+ * so it is waited for directly.
+ *
+ * @param shell Pointer to the shell structure.
+ * @return A finished job, or NULL if every job is still running.
+ */
+static t_job	*first_done_job(t_shell *shell)
+{
+	t_list	*node;
+	t_job	*job;
+	t_child	*child;
+
+	refresh_jobs(shell);
+	node = shell->jobs;
+	while (node)
+	{
+		job = (t_job *)node->content;
+		if (job->done)
+			return (job);
+		node = node->next;
+	}
+	node = shell->jobs;
+	while (node)
+	{
+		job = (t_job *)node->content;
+		child = find_child(job->pid, shell);
+		if (child && child->pidfd == -1 && update_job(job, true, shell))
+			return (job);
+		node = node->next;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Implements `wait -n`: waits for the next job to finish.
+ *
+ * @param shell Pointer to the shell structure.
+ * @return The exit status of the job, or 127 if there are no jobs.
+ */
+static int	wait_next(t_shell *shell)
+{
+	t_job	*job;
+	int		status;
+
+	if (!shell->jobs)
+		return (127);
+	job = first_done_job(shell);
+	while (!job)
+	{
+		supervisor_poll(-1, shell);
+		job = first_done_job(shell);
+	}
+	status = job_exit_code(job->status);
+	remove_job(job, shell);
+	return (status);
+}
+
+/**
+ * @brief Waits for the jobs given as `%N` or PIDs.
+ *
+ * @param specs NULL-terminated list of job specifications.
+ * @param shell Pointer to the shell structure.
+ * @return The exit status of the last job, or 127 if it is unknown.
+ */
+static int	wait_specs(char **specs, t_shell *shell)
+{
+	t_job	*job;
+	int		status;
+
+	status = EXIT_SUCCESS;
+	while (*specs)
+	{
+		job = find_job(*specs, shell);
+		if (!job && **specs == '%')
+			status = (error_msg("wait: ", *specs, ": no such job", shell), 127);
+		else if (!job)
+			status = (error_msg("wait: pid ", *specs,
+						" is not a child of this shell", shell), 127);
+		else
+		{
+			update_job(job, true, shell);
+			status = job_exit_code(job->status);
+			remove_job(job, shell);
+		}
+		specs++;
+	}
+	return (status);
+}
+
+/**
+ * @brief Implements the `wait` builtin.
+ *
+ * Without arguments, waits for every background job and returns 0.
+ * `wait -n` waits for the next job to finish, and `wait id...` waits for
+ * the given jobs (`%N` or PID); both return the status of the job. Jobs
+ * are reaped by the supervisor, so waiting never blocks on a process that
+ * has already exited.
+ *
+ * @param cmd Pointer to the command structure containing the arguments.
+ * @param io I/O context (unused).
+ * @param shell Pointer to the shell structure.
+ * @return The status described above.
+ */
+int	ft_wait(t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	(void)io;
+	if (!cmd->cmd_args[1])
+		return (wait_all(shell));
+	if (!ft_strcmp(cmd->cmd_args[1], "-n"))
+		return (wait_next(shell));
+	return (wait_specs(cmd->cmd_args + 1, shell));
+}
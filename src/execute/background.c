@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   background.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:13:21 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:13:21 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Forks the process of a background job.
+ *
+ * The child is asynchronous: it keeps SIGINT and SIGQUIT ignored (and so
+ * do the programs it starts), and its stdin is /dev/null, since there is no
+ * job control to give it the terminal.
+ *
+ * @param command AST node of the job's command.
+ * @param shell Pointer to the shell structure.
+ * @return PID of the job's process.
+ */
+static pid_t	fork_job(t_ast *command, t_shell *shell)
+{
+	pid_t	pid;
+	int		fd;
+
+	pid = create_process(shell);
+	if (pid == 0)
+	{
+		shell->is_main = false;
+		shell->is_async = true;
+		fd = open("/dev/null", O_RDONLY);
+		if (fd != -1)
+		{
+			duplicate_fd(fd, STDIN_FILENO, shell);
+			close_file(fd, shell);
+		}
+		run_cmd(command, OP_TERMINATE, shell);
+	}
+	return (pid);
+}
+
+/**
+ * @brief Starts a command in the background and runs the rest of the list.
+ *
+ * The job is recorded in the job table and `$!` is set to its PID; an
+ * interactive shell prints `[N] PID`. The shell does not wait for the job:
+ * the supervisor reaps it whenever it exits.
+ *
+ * @param bg Pointer to the background node.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, or the status of the rest of the list.
+ */
+int	process_bg(t_bg *bg, t_shell *shell)
+{
+	t_job	*job;
+	pid_t	pid;
+
+	pid = fork_job(bg->command, shell);
+	job = add_job(pid, bg->text, shell);
+	shell->last_bg_pid = pid;
+	if (shell->is_main && isatty(STDIN_FILENO))
+	{
+		ft_putchar_fd('[', STDERR_FILENO);
+		ft_putnbr_fd(job->id, STDERR_FILENO);
+		ft_putstr_fd("] ", STDERR_FILENO);
+		ft_putnbr_fd(pid, STDERR_FILENO);
+		ft_putchar_fd('\n', STDERR_FILENO);
+	}
+	if (!bg->next)
+		return (EXIT_SUCCESS);
+	return (run_cmd(bg->next, OP_COMPLETE, shell));
+}
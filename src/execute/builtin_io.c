@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   builtin_io.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:32:21 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:32:21 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Sets up the I/O context of a builtin.
+ *
+ * @param io Context to fill; its output buffer starts empty.
+ * @param plan Streams of the builtin, or NULL. Streams that are -1 (or
+ * all of them without a plan) are the shell's own.
+ */
+void	init_io(t_io *io, t_fd_plan *plan)
+{
+	ft_bzero(io, sizeof(t_io));
+	io->in = STDIN_FILENO;
+	io->out = STDOUT_FILENO;
+	io->err = STDERR_FILENO;
+	if (plan && plan->in != -1)
+		io->in = plan->in;
+	if (plan && plan->out != -1)
+		io->out = plan->out;
+	if (plan && plan->err != -1)
+		io->err = plan->err;
+}
+
+/**
+ * @brief Runs a builtin and writes its output.
+ *
+ * Builtins append their output to the buffer of the context; it is
+ * written to the output of the context in one piece once they return.
+ * Their error messages go to the error stream of the context, or nowhere
+ * if it is closed. Output for a closed stream, or output that cannot be
+ * written, is a write error: it is reported and the status becomes 1.
+ *
+ * @param function The builtin.
+ * @param cmd Its command.
+ * @param io I/O context of the builtin.
+ * @param shell Pointer to the shell structure.
+ * @return The status of the builtin.
+ */
+int	run_builtin(t_bltn_func function, t_cmd *cmd, t_io *io, t_shell *shell)
+{
+	int	status;
+	int	saved_err;
+
+	saved_err = shell->err_fd;
+	shell->err_fd = io->err;
+	if (io->err == FD_CLOSED)
+		shell->err_fd = open("/dev/null", O_WRONLY | O_CLOEXEC);
+	status = function(cmd, io, shell);
+	if (io->buf.len > 0 && io->out == FD_CLOSED)
+		status = error_msg(cmd->cmd_args[0], ": write error: ",
+				strerror(EBADF), shell);
+	else if (io->buf.len > 0 && outbuf_flush(&io->buf, io->out, shell) == -1)
+		status = error_msg(cmd->cmd_args[0], ": write error: ",
+				strerror(errno), shell);
+	if (io->err == FD_CLOSED && shell->err_fd != -1)
+		close(shell->err_fd);
+	shell->err_fd = saved_err;
+	return (status);
+}
+
+/**
+ * @brief Tells whether a node redirects the streams of a builtin.
+ *
+ * @param node AST node to check.
+ * @param shell Pointer to the shell structure.
+ * @return true if `node` is a chain of redirections around a builtin.
+ */
+bool	redirects_builtin(t_ast *node, t_shell *shell)
+{
+	t_ast	*target;
+
+	if (node->node_type != REDIR)
+		return (false);
+	target = redir_target(node);
+	if (!target || target->node_type != CMD)
+		return (false);
+	resolve_ast_content(target, shell);
+	return (target->u_node_cont.cmd.cmd_args[0]
+		&& fetch_builtin_cmd(target->u_node_cont.cmd.cmd_args[0]));
+}
+
+/**
+ * @brief Runs a builtin with its redirections.
+ *
+ * The chain is turned into an fd map, whose standard streams become the
+ * I/O context of the builtin, so the shell's own streams are left alone
+ * and an early return leaves nothing to restore. `exec` is the exception:
+ * its redirections are meant to stay (see `exec_redirections`).
+ *
+ * @param node Outermost REDIR node around a builtin.
+ * @param shell Pointer to the shell structure.
+ * @return The status of the builtin, or EXIT_FAILURE if a redirection
+ * failed.
+ */
+int	redirect_builtin(t_ast *node, t_shell *shell)
+{
+	t_fd_map	map;
+	t_io		io;
+	t_cmd		*cmd;
+	int			status;
+
+	status = build_fd_map(node, NULL, &map, shell);
+	if (status != EXIT_SUCCESS)
+		return (status);
+	cmd = &redir_target(node)->u_node_cont.cmd;
+	if (fetch_builtin_cmd(cmd->cmd_args[0]) == ft_exec)
+		return (exec_redirections(cmd, &map, shell));
+	init_io(&io, NULL);
+	io.in = map.fds[STDIN_FILENO];
+	io.out = map.fds[STDOUT_FILENO];
+	io.err = map.fds[STDERR_FILENO];
+	status = run_builtin(fetch_builtin_cmd(cmd->cmd_args[0]), cmd, &io,
+			shell);
+	release_fd_map(&map);
+	return (status);
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_hash.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:51:19 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:51:19 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Computes the bucket index of a command name (djb2).
+ *
+ * @param name Command name.
+ * @return Bucket index in the range [0, HASH_BUCKETS).
+ */
+static unsigned int	hash_name(const char *name)
+{
+	unsigned int	hash;
+
+	hash = 5381;
+	while (*name)
+		hash = hash * 33 + (unsigned char)*name++;
+	return (hash % HASH_BUCKETS);
+}
+
+/**
+ * @brief Finds the hash table node of a command.
+ *
+ * The table is synchronised with the current PATH generation first, so
+ * paths resolved under a previous PATH are never returned.
+ *
+ * @param name Command name to look up.
+ * @param shell Pointer to the shell structure holding the table.
+ * @return The list node holding the `t_hash_entry`, or NULL if not hashed.
+ */
+t_list	*hash_find(const char *name, t_shell *shell)
+{
+	t_list	*node;
+
+	hash_sync(shell);
+	node = shell->cmd_hash[hash_name(name)];
+	while (node)
+	{
+		if (ft_strcmp(((t_hash_entry *)node->content)->name, name) == 0)
+			return (node);
+		node = node->next;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Records the resolved path of a command in the hash table.
+ *
+ * An existing entry for the same name is updated in place and its hit
+ * counter is reset. Entries are not tracked by the memory trackers because
+ * the table outlives a single command line.
+ *
+ * @param name Command name.
+ * @param path Full path of the executable.
+ * @param hits Initial hit counter of the entry.
+ * @param shell Pointer to the shell structure holding the table.
+ * @return Pointer to the stored entry.
+ */
+t_hash_entry	*hash_store(const char *name, const char *path, int hits,
+		t_shell *shell)
+{
+	t_list			*node;
+	t_hash_entry	*entry;
+
+	node = hash_find(name, shell);
+	if (node)
+	{
+		entry = (t_hash_entry *)node->content;
+		free(entry->path);
+		entry->path = strdup_tracked(path, UNTRACKED, shell);
+		entry->hits = hits;
+		return (entry);
+	}
+	entry = calloc_tracked(1, sizeof(t_hash_entry), UNTRACKED, shell);
+	entry->name = strdup_tracked(name, UNTRACKED, shell);
+	entry->path = strdup_tracked(path, UNTRACKED, shell);
+	entry->hits = hits;
+	node = ft_lstnew(entry);
+	alloc_check(node, entry, shell);
+	ft_lstadd_back(&shell->cmd_hash[hash_name(name)], node);
+	return (entry);
+}
+
+/**
+ * @brief Removes a command from the hash table.
+ *
+ * @param name Command name to forget.
+ * @param shell Pointer to the shell structure holding the table.
+ * @return true if the command was hashed, false otherwise.
+ */
+bool	hash_remove(const char *name, t_shell *shell)
+{
+	t_list	*node;
+
+	node = hash_find(name, shell);
+	if (!node)
+		return (false);
+	del_node(&node, &shell->cmd_hash[hash_name(name)], free_hash_entry, true);
+	return (true);
+}
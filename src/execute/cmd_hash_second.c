@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_hash_second.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:51:19 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:51:19 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Frees a command hash table entry.
+ *
+ * @param data Pointer to the `t_hash_entry` to free.
+ */
+void	free_hash_entry(void *data)
+{
+	t_hash_entry	*entry;
+
+	if (data != NULL)
+	{
+		entry = (t_hash_entry *)data;
+		free(entry->name);
+		free(entry->path);
+		free(entry);
+	}
+}
+
+/**
+ * @brief Empties the command hash table.
+ *
+ * @param shell Pointer to the shell structure holding the table.
+ */
+void	hash_reset(t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (i < HASH_BUCKETS)
+		ft_lstclear(&shell->cmd_hash[i++], free_hash_entry);
+}
+
+/**
+ * @brief Drops every hash table entry if PATH changed since it was filled.
+ *
+ * `export` and `unset` bump the PATH generation when they touch PATH; the
+ * table remembers the generation it was filled under and empties itself on
+ * the first use after a change.
+ *
+ * @param shell Pointer to the shell structure holding the table.
+ */
+void	hash_sync(t_shell *shell)
+{
+	if (shell->hash_gen != shell->path_gen)
+	{
+		hash_reset(shell);
+		shell->hash_gen = shell->path_gen;
+	}
+}
+
+/**
+ * @brief Returns the hashed path of a command, counting the hit.
+ *
+ * The remembered path is checked with a single `access` call; if the
+ * executable has disappeared, the entry is dropped and the caller falls
+ * back to a full PATH search.
+ *
+ * @param name Command name to look up.
+ * @param shell Pointer to the shell structure holding the table.
+ * @return Tracked copy of the hashed path, or NULL on a miss.
+ */
+char	*hash_lookup(const char *name, t_shell *shell)
+{
+	t_list			*node;
+	t_hash_entry	*entry;
+
+	node = hash_find(name, shell);
+	if (!node)
+		return (NULL);
+	entry = (t_hash_entry *)node->content;
+	if (access(entry->path, X_OK) == -1)
+	{
+		hash_remove(name, shell);
+		return (NULL);
+	}
+	entry->hits++;
+	return (strdup_tracked(entry->path, COMMAND_TRACK, shell));
+}
@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cmd_subst.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:53:17 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:53:17 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a command can be captured inside the shell.
+ *
+ * That is a state-free builtin call (see `is_pure_builtin`) that does not
+ * read its input, or a pipeline made only of them. The commands are
+ * expanded to find out.
+ *
+ * @param node Root of the command.
+ * @param shell Pointer to the shell structure.
+ * @return true if the output can be captured without a fork.
+ */
+static bool	is_capturable(t_ast *node, t_shell *shell)
+{
+	if (node->node_type == PIPE)
+		return (is_capturable(node->u_node_cont.pipe.input_side, shell)
+			&& is_capturable(node->u_node_cont.pipe.output_side, shell));
+	if (node->node_type != CMD)
+		return (false);
+	resolve_ast_content(node, shell);
+	return (node->u_node_cont.cmd.cmd_args[0]
+		&& fetch_builtin_cmd(node->u_node_cont.cmd.cmd_args[0])
+		&& is_pure_builtin(&node->u_node_cont.cmd)
+		&& !builtin_reads_input(&node->u_node_cont.cmd));
+}
+
+/**
+ * @brief Captures the output of state-free builtins without a fork.
+ *
+ * Each builtin writes into the buffer of its I/O context, which simply
+ * becomes the captured output. Builtins of a pipeline do not read their
+ * input, so only the output of the last one is kept.
+ *
+ * @param node A command accepted by `is_capturable`.
+ * @param out Buffer receiving the output.
+ * @param shell Pointer to the shell structure.
+ */
+static void	capture_builtins(t_ast *node, t_outbuf *out, t_shell *shell)
+{
+	t_cmd	*cmd;
+	t_io	io;
+
+	if (node->node_type == PIPE)
+	{
+		capture_builtins(node->u_node_cont.pipe.input_side, out, shell);
+		capture_builtins(node->u_node_cont.pipe.output_side, out, shell);
+		return ;
+	}
+	cmd = &node->u_node_cont.cmd;
+	init_io(&io, NULL);
+	io.captured = true;
+	shell->prev_cmd_status = fetch_builtin_cmd(cmd->cmd_args[0])(cmd, &io,
+			shell);
+	*out = io.buf;
+}
+
+/**
+ * @brief Runs a command with its output sent to a pipe, and exits.
+ *
+ * @param tree The command.
+ * @param fd Write end of the pipe.
+ * @param shell Pointer to the shell structure.
+ */
+static void	run_captured(t_ast *tree, int fd, t_shell *shell)
+{
+	shell->is_main = false;
+	signals_child(shell);
+	duplicate_fd(fd, STDOUT_FILENO, shell);
+	run_cmd(tree, OP_TERMINATE, shell);
+}
+
+/**
+ * @brief Captures the output of a command run in a child process.
+ *
+ * The output is read from a pipe in chunks of COPY_BUF_SIZE bytes.
+ *
+ * @param tree The command.
+ * @param out Buffer receiving the output.
+ * @param shell Pointer to the shell structure.
+ */
+static void	capture_child(t_ast *tree, t_outbuf *out, t_shell *shell)
+{
+	char	chunk[COPY_BUF_SIZE];
+	int		fds[2];
+	pid_t	pid;
+	ssize_t	count;
+	int		raw_status;
+
+	create_pipe(fds, shell);
+	pid = create_process(shell);
+	if (pid == 0)
+		run_captured(tree, fds[1], shell);
+	close(fds[1]);
+	count = 1;
+	while (count > 0 || (count == -1 && errno == EINTR))
+	{
+		count = read(fds[0], chunk, COPY_BUF_SIZE);
+		if (count > 0)
+			outbuf_add(out, chunk, count, shell);
+	}
+	close(fds[0]);
+	wait_for_child(pid, &raw_status, shell);
+	shell->prev_cmd_status = handle_exit_signal(raw_status, NULL, shell);
+}
+
+/**
+ * @brief Runs a command substitution and returns its output.
+ *
+ * A state-free builtin or builtin pipeline is captured inside the shell
+ * (see `capture_builtins`); anything else runs in a child process, like a
+ * subshell. As in bash, NUL bytes are dropped and trailing newlines are
+ * removed; word splitting is left to the caller. Its status becomes `$?`
+ * for the rest of the expansion.
+ *
+ * @param text The command line, without `$(` and `)`.
+ * @param shell Pointer to the shell structure.
+ * @return The output.
+ */
+char	*command_subst(char *text, t_shell *shell)
+{
+	t_ast		*tree;
+	t_outbuf	out;
+	size_t		i;
+	size_t		kept;
+
+	ft_bzero(&out, sizeof(t_outbuf));
+	tree = parse_command_text(text, shell);
+	if (tree && is_capturable(tree, shell))
+		capture_builtins(tree, &out, shell);
+	else if (tree)
+		capture_child(tree, &out, shell);
+	if (!out.data)
+		return (strdup_tracked("", COMMAND_TRACK, shell));
+	i = 0;
+	kept = 0;
+	while (i < out.len)
+	{
+		if (out.data[i])
+			out.data[kept++] = out.data[i];
+		i++;
+	}
+	while (kept > 0 && out.data[kept - 1] == '\n')
+		kept--;
+	out.data[kept] = '\0';
+	return (out.data);
+}
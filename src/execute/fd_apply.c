@@ -0,0 +1,119 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_apply.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:45:12 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:45:12 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a descriptor is a file opened for an fd map.
+ *
+ * @param map The map.
+ * @param fd The descriptor.
+ * @return true if an entry of the map owns `fd`.
+ */
+static bool	is_owned_fd(t_fd_map *map, int fd)
+{
+	int	target;
+
+	target = -1;
+	while (++target < FD_MAP_SIZE)
+		if (map->owned[target] && map->fds[target] == fd)
+			return (true);
+	return (false);
+}
+
+/**
+ * @brief Applies the fd operations of a map to the current process.
+ *
+ * A file of the map that ends up on a descriptor the operations wrote is
+ * no longer the map's: it is either in place or already replaced, and
+ * releasing the map leaves that descriptor alone.
+ *
+ * @param map The map the steps come from.
+ * @param steps Steps from `schedule_fd_map`.
+ * @param count Number of steps.
+ * @param shell Pointer to the shell structure.
+ */
+void	apply_fd_steps(t_fd_map *map, t_fd_step *steps, int count,
+		t_shell *shell)
+{
+	int	i;
+	int	target;
+
+	i = -1;
+	while (++i < count)
+	{
+		if (steps[i].src == FD_CLOSED)
+			close(steps[i].dst);
+		else if (steps[i].src == steps[i].dst)
+			fcntl(steps[i].dst, F_SETFD, 0);
+		else
+			duplicate_fd(steps[i].src, steps[i].dst, shell);
+		target = -1;
+		while (++target < FD_MAP_SIZE)
+			if (map->fds[target] == steps[i].dst)
+				map->owned[target] = false;
+	}
+}
+
+/**
+ * @brief Saves the descriptors the fd operations of a map overwrite.
+ *
+ * The copies are close-on-exec and above the mapped range, so the
+ * commands run in between neither inherit nor clobber them. A descriptor
+ * that is closed, or that is a file of the map, has nothing to save.
+ *
+ * @param map The map the steps come from.
+ * @param steps Steps about to be applied.
+ * @param count Number of steps.
+ * @param saved Storage for `count` copies; -1 where nothing was saved.
+ */
+void	save_fd_targets(t_fd_map *map, t_fd_step *steps, int count,
+		int *saved)
+{
+	int	i;
+
+	i = -1;
+	while (++i < count)
+	{
+		saved[i] = -1;
+		if (!is_owned_fd(map, steps[i].dst))
+			saved[i] = fcntl(steps[i].dst, F_DUPFD_CLOEXEC, FD_MAP_SIZE);
+	}
+}
+
+/**
+ * @brief Puts back the descriptors saved by `save_fd_targets`.
+ *
+ * A descriptor without a copy is closed, as it was before the operations.
+ *
+ * @param steps Steps that were applied.
+ * @param count Number of steps.
+ * @param saved The copies; they are closed.
+ * @param shell Pointer to the shell structure.
+ */
+void	restore_fd_targets(t_fd_step *steps, int count, int *saved,
+		t_shell *shell)
+{
+	int	i;
+
+	i = count;
+	while (--i >= 0)
+	{
+		if (saved[i] == -1)
+		{
+			close(steps[i].dst);
+			continue ;
+		}
+		duplicate_fd(saved[i], steps[i].dst, shell);
+		close(saved[i]);
+	}
+}
@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_map.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:44:30 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:44:30 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Points an entry of an fd map to a new descriptor.
+ *
+ * The previous descriptor of the entry is closed if the map owns it and
+ * no other entry still refers to it.
+ *
+ * @param map The map.
+ * @param target Entry to change.
+ * @param src Its new descriptor, or FD_CLOSED.
+ * @param owned Whether the map owns `src`.
+ */
+static void	set_fd(t_fd_map *map, int target, int src, bool owned)
+{
+	int		old;
+	bool	shared;
+	int		fd;
+
+	old = map->fds[target];
+	if (old == src && map->owned[target] == owned)
+		return ;
+	shared = false;
+	fd = -1;
+	while (++fd < FD_MAP_SIZE)
+		if (fd != target && map->fds[fd] == old && map->owned[fd])
+			shared = true;
+	if (map->owned[target] && !shared)
+		close(old);
+	map->fds[target] = src;
+	map->owned[target] = owned;
+}
+
+/**
+ * @brief Applies a duplication (`n>&m`, `n<&m`, `n>&-`) to an fd map.
+ *
+ * The source is read from the map, so earlier redirections of the chain
+ * are taken into account. A source the map leaves alone must be open in
+ * the shell and inherited by its commands: the shell's own descriptors
+ * are close-on-exec and cannot be borrowed.
+ *
+ * @param map The map.
+ * @param redir The duplication.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, EXIT_FAILURE after reporting the error, or -1 if
+ * the word of `>&` is not a descriptor and names a file.
+ */
+static int	dup_redir(t_fd_map *map, t_redir *redir, t_shell *shell)
+{
+	char	*word;
+	int		src;
+	int		i;
+
+	word = redir->filename;
+	if (!ft_strcmp(word, "-"))
+		return (set_fd(map, redir->fd, FD_CLOSED, false), EXIT_SUCCESS);
+	i = 0;
+	while (ft_isdigit(word[i]))
+		i++;
+	if ((i == 0 || word[i]) && redir->redir_type == T_DUP_OUT)
+		return (-1);
+	if (i == 0 || word[i])
+		return (error_msg(word, NULL, ": ambiguous redirect", shell));
+	src = FD_MAP_SIZE;
+	if (i < 3)
+		src = ft_atoi(word);
+	if (src >= FD_MAP_SIZE || map->fds[src] == FD_CLOSED
+		|| (map->fds[src] == src && !map->owned[src]
+			&& (fcntl(src, F_GETFD) & FD_CLOEXEC)))
+		return (error_msg(word, NULL, ": Bad file descriptor", shell));
+	set_fd(map, redir->fd, map->fds[src], map->owned[src]);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Applies one redirection to an fd map.
+ *
+ * A file is opened close-on-exec and owned by the map. `&>`, `&>>` and
+ * `>&file` send both stdout and stderr to it.
+ *
+ * @param map The map.
+ * @param redir The redirection, already expanded.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE after reporting the error.
+ */
+static int	add_redir(t_fd_map *map, t_redir *redir, t_shell *shell)
+{
+	int	status;
+	int	fd;
+
+	if (redir->redir_type == T_DUP_IN || redir->redir_type == T_DUP_OUT)
+	{
+		status = dup_redir(map, redir, shell);
+		if (status != -1)
+			return (status);
+	}
+	fd = open_redir_file(redir, shell);
+	if (fd == -1)
+		return (error_msg_errno(redir->filename, shell));
+	set_fd(map, redir->fd, fd, true);
+	if (redir->redir_type == T_OUT_ALL || redir->redir_type == T_APPEND_ALL
+		|| (redir->redir_type == T_DUP_OUT && redir->fd == STDOUT_FILENO))
+		set_fd(map, STDERR_FILENO, fd, true);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Builds the fd map of a chain of redirections.
+ *
+ * Redirections are expanded and applied from the outermost to the
+ * innermost, which is their order in the command line, on top of the
+ * streams of the stage. Nothing is duplicated yet: the map only records
+ * which descriptor each of fds 0 to 9 of the command becomes, and is
+ * turned into the shortest list of operations by `schedule_fd_map`.
+ *
+ * @param node Outermost REDIR node of the chain.
+ * @param plan Fd plan of the stage, or NULL to start from the shell's own
+ * streams.
+ * @param map Map to fill.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE after reporting an error (the map
+ * is then released).
+ */
+int	build_fd_map(t_ast *node, t_fd_plan *plan, t_fd_map *map, t_shell *shell)
+{
+	int	status;
+
+	init_fd_map(map, plan);
+	while (node && node->node_type == REDIR)
+	{
+		resolve_ast_content(node, shell);
+		status = add_redir(map, &node->u_node_cont.redir, shell);
+		if (status != EXIT_SUCCESS)
+			return (release_fd_map(map), status);
+		node = node->u_node_cont.redir.command;
+	}
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Closes the descriptors owned by an fd map.
+ *
+ * @param map The map; all its entries are inherited afterwards.
+ */
+void	release_fd_map(t_fd_map *map)
+{
+	int	fd;
+
+	fd = -1;
+	while (++fd < FD_MAP_SIZE)
+		set_fd(map, fd, fd, false);
+}
@@ -0,0 +1,105 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_plan.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:27:59 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:27:59 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the command under a chain of redirections.
+ *
+ * @param node AST node, possibly a REDIR.
+ * @return The first node of the chain that is not a REDIR.
+ */
+t_ast	*redir_target(t_ast *node)
+{
+	while (node && node->node_type == REDIR)
+		node = node->u_node_cont.redir.command;
+	return (node);
+}
+
+/**
+ * @brief Tells whether a node redirects the streams of an external command.
+ *
+ * The command is expanded to find out; its redirections are not, so they
+ * are still expanded once, in order, by whoever applies them.
+ *
+ * @param node AST node to check.
+ * @param shell Pointer to the shell structure.
+ * @return true if `node` is a chain of redirections around a command that
+ * is not a builtin.
+ */
+bool	redirects_external(t_ast *node, t_shell *shell)
+{
+	t_ast	*target;
+
+	if (node->node_type != REDIR)
+		return (false);
+	target = redir_target(node);
+	if (!target || target->node_type != CMD)
+		return (false);
+	resolve_ast_content(target, shell);
+	return (target->u_node_cont.cmd.cmd_args[0]
+		&& !fetch_builtin_cmd(target->u_node_cont.cmd.cmd_args[0]));
+}
+
+/**
+ * @brief Opens the file of a redirection, close-on-exec.
+ *
+ * Heredocs and here-strings have no file: their body is served from
+ * memory (see `open_heredoc`). A duplication whose word is not a
+ * descriptor names a file to write, like `&>`.
+ *
+ * @param redir The redirection.
+ * @param shell Pointer to the shell structure.
+ * @return The descriptor, or -1 with errno set.
+ */
+int	open_redir_file(t_redir *redir, t_shell *shell)
+{
+	if (redir->redir_type == T_HDOC || redir->redir_type == T_HSTR)
+		return (open_heredoc(redir, shell));
+	if (redir->redir_type == T_INPUT)
+		return (open(redir->filename, O_RDONLY | O_CLOEXEC));
+	shell->fs_epoch++;
+	if (redir->redir_type == T_RDWR)
+		return (open(redir->filename, O_CREAT | O_RDWR | O_CLOEXEC, 0644));
+	if (redir->redir_type == T_APPEND || redir->redir_type == T_APPEND_ALL)
+		return (open(redir->filename, O_CREAT | O_WRONLY | O_APPEND
+				| O_CLOEXEC, 0644));
+	return (open(redir->filename, O_CREAT | O_WRONLY | O_TRUNC | O_CLOEXEC,
+			0644));
+}
+
+/**
+ * @brief Starts an fd map from the streams of a stage.
+ *
+ * Entry `t` of the map is the descriptor of the shell that becomes `t` in
+ * the command; an entry equal to its index is inherited as it is.
+ *
+ * @param map Map to fill; no entry is owned.
+ * @param plan Fd plan of the stage, or NULL to inherit all streams.
+ */
+void	init_fd_map(t_fd_map *map, t_fd_plan *plan)
+{
+	int	fd;
+
+	fd = -1;
+	while (++fd < FD_MAP_SIZE)
+	{
+		map->fds[fd] = fd;
+		map->owned[fd] = false;
+	}
+	if (plan && plan->in != -1)
+		map->fds[STDIN_FILENO] = plan->in;
+	if (plan && plan->out != -1)
+		map->fds[STDOUT_FILENO] = plan->out;
+	if (plan && plan->err != -1)
+		map->fds[STDERR_FILENO] = plan->err;
+}
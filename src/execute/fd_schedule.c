@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_schedule.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:44:59 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:44:59 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a descriptor is still needed as a source.
+ *
+ * @param map The map.
+ * @param done Entries whose step is already scheduled.
+ * @param fd Descriptor about to be overwritten.
+ * @return true if a pending entry other than `fd` itself reads `fd`.
+ */
+static bool	is_read_later(t_fd_map *map, bool *done, int fd)
+{
+	int	target;
+
+	target = -1;
+	while (++target < FD_MAP_SIZE)
+		if (!done[target] && target != fd && map->fds[target] == fd)
+			return (true);
+	return (false);
+}
+
+/**
+ * @brief Schedules every pending entry that no other entry still reads.
+ *
+ * An entry that keeps its own descriptor (`src == dst`) overwrites
+ * nothing and is always ready.
+ *
+ * @param map The map.
+ * @param done Entries whose step is already scheduled.
+ * @param steps Step list to extend.
+ * @param count Number of steps so far.
+ * @return The new number of steps.
+ */
+static int	take_ready(t_fd_map *map, bool *done, t_fd_step *steps,
+		int count)
+{
+	int	target;
+
+	target = -1;
+	while (++target < FD_MAP_SIZE)
+	{
+		if (done[target] || (map->fds[target] != target
+				&& is_read_later(map, done, target)))
+			continue ;
+		steps[count].src = map->fds[target];
+		steps[count].dst = target;
+		done[target] = true;
+		count++;
+	}
+	return (count);
+}
+
+/**
+ * @brief Makes the entries that read a descriptor read a copy of it.
+ *
+ * @param map The map.
+ * @param fd The descriptor; it is closed if the map owned it.
+ * @param copy The copy, which the map owns.
+ */
+static void	use_copy(t_fd_map *map, int fd, int copy)
+{
+	int		target;
+	bool	owned;
+
+	owned = false;
+	target = -1;
+	while (++target < FD_MAP_SIZE)
+	{
+		if (target == fd || map->fds[target] != fd)
+			continue ;
+		owned = owned || map->owned[target];
+		map->fds[target] = copy;
+		map->owned[target] = true;
+	}
+	if (owned)
+		close(fd);
+}
+
+/**
+ * @brief Breaks a cycle of the map, as in `3>&1 1>&2 2>&3`.
+ *
+ * When every pending entry is read by another one, the first of them is
+ * copied out of the way (above the mapped range, close-on-exec) and the
+ * entries that read it use the copy.
+ *
+ * @param map The map.
+ * @param done Entries whose step is already scheduled.
+ * @param shell Pointer to the shell structure.
+ * @return false if no entry is pending.
+ */
+static bool	break_cycle(t_fd_map *map, bool *done, t_shell *shell)
+{
+	int	fd;
+	int	copy;
+
+	fd = 0;
+	while (fd < FD_MAP_SIZE && done[fd])
+		fd++;
+	if (fd == FD_MAP_SIZE)
+		return (false);
+	copy = fcntl(fd, F_DUPFD_CLOEXEC, FD_MAP_SIZE);
+	if (copy == -1)
+		exit_on_sys_error("fcntl", errno, shell);
+	use_copy(map, fd, copy);
+	return (true);
+}
+
+/**
+ * @brief Turns an fd map into the shortest list of fd operations.
+ *
+ * Entries are a parallel assignment: all sources are read as they were
+ * before the first operation. An entry equal to its index and not owned
+ * needs nothing. Any other entry becomes one step: a `dup2` from its
+ * source, a close for FD_CLOSED, or, for a file the map owns that was
+ * opened on its own number, clearing its close-on-exec flag
+ * (`src == dst`). A step is only emitted once no later step reads the
+ * descriptor it overwrites; a cycle costs one extra copy.
+ *
+ * @param map The map; cycle copies are added to it as owned entries.
+ * @param steps Storage for at most FD_MAP_SIZE steps, applied in order.
+ * @param shell Pointer to the shell structure.
+ * @return The number of steps.
+ */
+int	schedule_fd_map(t_fd_map *map, t_fd_step *steps, t_shell *shell)
+{
+	bool	done[FD_MAP_SIZE];
+	int		count;
+	int		next;
+	int		fd;
+
+	fd = -1;
+	while (++fd < FD_MAP_SIZE)
+		done[fd] = (map->fds[fd] == fd && !map->owned[fd]);
+	count = 0;
+	while (true)
+	{
+		next = take_ready(map, done, steps, count);
+		if (next == count && !break_cycle(map, done, shell))
+			break ;
+		count = next;
+	}
+	return (count);
+}
@@ -47,86 +47,84 @@ char	**generate_paths(t_shell *shell)
 }
 
 /**
- * @brief Finds the path to an executable file.
+ * @brief Checks a command given as a path (containing '/').
  *
- * This function checks whether the command is a given path or needs to be
- * searched in the PATH environment variable. If the command contains
- * '/', it checks the file's availability at the specified path.
- * Otherwise, the function searches for the command in PATH.
+ * @param cmd Path to the executable file.
+ * @param shell Pointer to the shell structure for error reporting.
+ * @return EXIT_SUCCESS if the file can be executed, 127 if it does not
+ * exist, 126 if it is not executable or is a directory.
+ */
+static int	check_explicit_path(char *cmd, t_shell *shell)
+{
+	struct stat	file_info;
+
+	if (access(cmd, X_OK) == -1)
+	{
+		if (errno == EACCES)
+			return (report_cmd_error(cmd, "Permission denied", 126, shell));
+		else if (errno == ENOENT)
+			return (report_cmd_error(cmd, "No such file or directory", 127,
+					shell));
+		return (report_cmd_error(cmd, strerror(errno), 126, shell));
+	}
+	if (stat(cmd, &file_info) == 0 && S_ISDIR(file_info.st_mode))
+		return (report_cmd_error(cmd, "Is a directory", 126, shell));
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Resolves a command to the path of an executable file.
+ *
+ * If the command contains '/', the file at that path is checked. Otherwise
+ * the command is looked up in the hash table, the cache of missing
+ * commands, and finally in PATH. This function never exits, so it can run
+ * in the main shell before any process is created: a command that cannot
+ * be executed costs no fork, and the caches it fills are kept for the
+ * following commands.
  *
  * @param cmd Command name or path to the executable file.
+ * @param exec_path Set to the path of the executable on success.
  * @param shell Pointer to the shell structure for memory management.
- * @return Path to the executable file or NULL if the command is not found.
+ * @return EXIT_SUCCESS, or the exit status of the failed command (126 or
+ * 127) after printing the error.
  */
-char	*find_executable_path(char *cmd, t_shell *shell)
+int	resolve_executable(char *cmd, char **exec_path, t_shell *shell)
 {
-	struct stat	file_info;
+	int	status;
 
+	*exec_path = NULL;
 	if (ft_strncmp(cmd, "", 1) == 0)
-		exit_on_error("command not found", cmd, 127, shell);
+		return (report_cmd_error(cmd, "command not found", 127, shell));
 	else if (ft_strchr(cmd, '/'))
 	{
-		if (access(cmd, X_OK) == -1)
-		{
-			if (errno == EACCES)
-				exit_on_error("Permission denied", cmd, 126, shell);
-			else if (errno == ENOENT)
-				exit_on_error("No such file or directory", cmd, 127, shell);
-			else
-				exit_on_sys_error(cmd, errno, shell);
-		}
-		get_file_status(cmd, &file_info, shell);
-		if (S_ISDIR(file_info.st_mode))
-			exit_on_error("Is a directory", cmd, 126, shell);
-		return (cmd);
+		status = check_explicit_path(cmd, shell);
+		if (status == EXIT_SUCCESS)
+			*exec_path = cmd;
+		return (status);
 	}
 	else if (ft_strncmp(cmd, ".", 1) == 0 || ft_strncmp(cmd, "..", 2) == 0)
-		exit_on_error("command not found", cmd, 127, shell);
-	else
-		return (locate_executable(cmd, shell));
-	return (NULL);
+		return (report_cmd_error(cmd, "command not found", 127, shell));
+	return (resolve_in_path(cmd, exec_path, shell));
 }
+
 /**
- * @brief Searches for an executable file in the directories 
- * specified in PATH.
+ * @brief Finds the path to an executable file, or exits.
  *
- * This function iterates over directories in the PATH variable 
- * and tries to find
- * the executable file. If the file is found and is executable, 
- * the function returns
- * its full path. Otherwise, it returns an error message.
+ * Wrapper around `resolve_executable` for code running in a child process:
+ * if the command cannot be executed, the process exits with the status of
+ * the failure.
  *
- * @param bin_name Name of the executable file.
- * @param sh Pointer to the shell structure for memory management.
- * @return Full path to the executable file or NULL if the command 
- * is not found.
+ * @param cmd Command name or path to the executable file.
+ * @param shell Pointer to the shell structure for memory management.
+ * @return Path to the executable file.
  */
-
-char	*locate_executable(char *bin_name, t_shell *sh)
+char	*find_executable_path(char *cmd, t_shell *shell)
 {
-	char	*full_path;
-	bool	access_error;
-	char	**dir_paths;
-	int		i;
+	char	*exec_path;
+	int		status;
 
-	dir_paths = generate_paths(sh);
-	if (!dir_paths)
-		exit_on_error("command not found in PATH", bin_name, 127, sh);
-	access_error = false;
-	i = -1;
-	while (dir_paths[++i] != NULL)
-	{
-		full_path = strjoin_tracked(strjoin_tracked(dir_paths[i], "/",
-					COMMAND_TRACK, sh), bin_name, COMMAND_TRACK, sh);
-		if (access(full_path, X_OK) == EXIT_SUCCESS)
-			return (full_path);
-		else if (errno == EACCES)
-			access_error = true;
-		else if (errno != ENOENT)
-			exit_on_sys_error("error accessing path", errno, sh);
-	}
-	if (access_error)
-		exit_on_error("Permission denied", bin_name, 126, sh);
-	exit_on_error("command not found", bin_name, 127, sh);
-	return (NULL);
+	status = resolve_executable(cmd, &exec_path, shell);
+	if (status != EXIT_SUCCESS)
+		clean_exit(status, shell);
+	return (exec_path);
 }
@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   find_path_second.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:55:36 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:55:36 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Prints "minishell: name: msg" and returns the given status.
+ *
+ * @param name Command that failed.
+ * @param msg Description of the failure.
+ * @param status Exit status to return.
+ * @param shell Pointer to the shell structure for output.
+ * @return The `status` argument.
+ */
+int	report_cmd_error(char *name, char *msg, int status, t_shell *shell)
+{
+	error_msg(name, ": ", msg, shell);
+	return (status);
+}
+
+/**
+ * @brief Searches the directories listed in PATH for an executable.
+ *
+ * The directories come from the cached descriptor array, which is only
+ * rebuilt when PATH changes; each directory is probed with `faccessat` and
+ * the full path string is built once, for the directory that matched.
+ * This function never exits: it reports a miss by returning NULL.
+ *
+ * @param bin_name Name of the executable file.
+ * @param access_error Set to true if a matching file was found but is not
+ * executable.
+ * @param sh Pointer to the shell structure for memory management.
+ * @return Full path to the executable file or NULL if it was not found.
+ */
+char	*search_path(char *bin_name, bool *access_error, t_shell *sh)
+{
+	t_path_dirs	*path_dirs;
+	int			result;
+	int			i;
+
+	*access_error = false;
+	path_dirs = get_path_dirs(sh);
+	i = -1;
+	while (++i < path_dirs->count)
+	{
+		result = probe_path_dir(path_dirs, i, bin_name);
+		if (result == 0)
+			return (join_exec_path(path_dirs->dirs[i], bin_name, sh));
+		else if (result == EACCES)
+			*access_error = true;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Resolves a command name through the caches and PATH.
+ *
+ * The command hash table is consulted first, then the cache of recent
+ * misses; otherwise the directories of PATH are searched and the result is
+ * remembered in the matching cache.
+ *
+ * @param name Name of the executable file.
+ * @param exec_path Set to the full path of the executable on success.
+ * @param sh Pointer to the shell structure for memory management.
+ * @return EXIT_SUCCESS, 127 if the command was not found, or 126 if a
+ * matching file exists but is not executable.
+ */
+int	resolve_in_path(char *name, char **exec_path, t_shell *sh)
+{
+	bool	access_error;
+
+	*exec_path = hash_lookup(name, sh);
+	if (*exec_path)
+		return (EXIT_SUCCESS);
+	if (neg_cache_hit(name, sh))
+		return (report_cmd_error(name, "command not found", 127, sh));
+	*exec_path = search_path(name, &access_error, sh);
+	if (*exec_path)
+	{
+		hash_store(name, *exec_path, 1, sh);
+		return (EXIT_SUCCESS);
+	}
+	if (access_error)
+		return (report_cmd_error(name, "Permission denied", 126, sh));
+	neg_cache_add(name, sh);
+	return (report_cmd_error(name, "command not found", 127, sh));
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_fd.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:35:22 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:35:22 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends the expansion of `$name`, `${name}`, `$?` or `$!` to a
+ * heredoc body.
+ *
+ * @param str Body text starting at the `$`.
+ * @param out Buffer receiving the expanded body.
+ * @param shell Pointer to the shell structure.
+ * @return The number of characters consumed.
+ */
+static size_t	append_param(char *str, t_outbuf *out, t_shell *shell)
+{
+	size_t	len;
+	char	*value;
+
+	len = 2;
+	if (str[1] == '{')
+		value = brace_param(str, &len, shell);
+	else if (str[1] == '?')
+		value = manage_memory(ft_itoa(shell->prev_cmd_status), COMMAND_TRACK,
+				shell);
+	else if (str[1] == '!')
+		value = last_bg_pid_value(shell);
+	else if (!ft_isalpha(str[1]) && str[1] != '_')
+		len = 0;
+	else
+	{
+		while (ft_isalnum(str[len]) || str[len] == '_')
+			len++;
+		value = lookup_param(manage_memory(ft_substr(str, 1, len - 1),
+					COMMAND_TRACK, shell), shell);
+	}
+	if (len == 0)
+		return (outbuf_add(out, "$", 1, shell), 1);
+	if (value)
+		outbuf_append(out, value, shell);
+	return (len);
+}
+
+/**
+ * @brief Appends an escaped character of a heredoc body.
+ *
+ * @param str Body text starting at the backslash.
+ * @param out Buffer receiving the expanded body.
+ * @param shell Pointer to the shell structure.
+ * @return The number of characters consumed.
+ */
+static size_t	append_escape(char *str, t_outbuf *out, t_shell *shell)
+{
+	if (str[1] == '$' || str[1] == '\\')
+		return (outbuf_add(out, str + 1, 1, shell), 2);
+	if (str[1] == '\n')
+		return (2);
+	outbuf_add(out, str, 1, shell);
+	return (1);
+}
+
+/**
+ * @brief Expands the body of an unquoted heredoc.
+ *
+ * Parameters are expanded; a backslash quotes `$` and `\`, and joins a
+ * line with the next one. Quotes are ordinary characters.
+ *
+ * @param str The body as read.
+ * @param len Set to the length of the result.
+ * @param shell Pointer to the shell structure.
+ * @return The expanded body.
+ */
+static char	*expand_heredoc(char *str, size_t *len, t_shell *shell)
+{
+	t_outbuf	out;
+	size_t		run;
+
+	ft_bzero(&out, sizeof(t_outbuf));
+	outbuf_add(&out, "", 0, shell);
+	while (*str)
+	{
+		run = 0;
+		while (str[run] && str[run] != '$' && str[run] != '\\')
+			run++;
+		outbuf_add(&out, str, run, shell);
+		str += run;
+		if (*str == '$')
+			str += append_param(str, &out, shell);
+		else if (*str == '\\')
+			str += append_escape(str, &out, shell);
+	}
+	*len = out.len;
+	return (out.data);
+}
+
+/**
+ * @brief Opens a descriptor that reads the body of a heredoc or of a
+ * here-string.
+ *
+ * Nothing touches the disk. A heredoc body that fits in PIPE_BUF is
+ * written to a pipe in one atomic write, which cannot block on an empty
+ * pipe, so no writer process is needed. Larger bodies and here-strings go
+ * to a memfd that is rewound and sealed against changes, so the command
+ * reads them like a regular file.
+ *
+ * @param redir The redirection, with its body.
+ * @param shell Pointer to the shell structure.
+ * @return A close-on-exec descriptor positioned at the start of the body,
+ * or -1 with errno set.
+ */
+int	open_heredoc(t_redir *redir, t_shell *shell)
+{
+	char	*body;
+	size_t	len;
+	int		fds[2];
+
+	body = redir->body;
+	len = redir->body_len;
+	if (redir->expand_body)
+		body = expand_heredoc(body, &len, shell);
+	if (redir->redir_type == T_HDOC && len <= PIPE_BUF
+		&& pipe2(fds, O_CLOEXEC) == 0)
+	{
+		if (write_all(fds[PIPE_OUTPUT], body, len) == -1)
+			return (close(fds[PIPE_INPUT]), close(fds[PIPE_OUTPUT]), -1);
+		close(fds[PIPE_OUTPUT]);
+		return (fds[PIPE_INPUT]);
+	}
+	fds[0] = memfd_create("heredoc", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+	if (fds[0] == -1)
+		return (-1);
+	if (write_all(fds[0], body, len) == -1 || lseek(fds[0], 0, SEEK_SET) == -1)
+		return (close(fds[0]), -1);
+	fcntl(fds[0], F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE);
+	return (fds[0]);
+}
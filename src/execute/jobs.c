@@ -0,0 +1,122 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jobs.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:12:21 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:12:21 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Converts a raw wait status into an exit code.
+ *
+ * @param raw_status Status as returned by `wait4`.
+ * @return The exit code, or 128 + signal number for a killed process.
+ */
+int	job_exit_code(int raw_status)
+{
+	if (WIFEXITED(raw_status))
+		return (WEXITSTATUS(raw_status));
+	if (WIFSIGNALED(raw_status))
+		return (128 + WTERMSIG(raw_status));
+	return (EXIT_FAILURE);
+}
+
+/**
+ * @brief Records a background job in the job table.
+ *
+ * Jobs are numbered from 1, one more than the highest number in use. The
+ * record and its text outlive the command that started the job.
+ *
+ * @param pid PID of the job's process.
+ * @param text Source text of the command.
+ * @param shell Pointer to the shell structure.
+ * @return The new job.
+ */
+t_job	*add_job(pid_t pid, char *text, t_shell *shell)
+{
+	t_job	*job;
+	t_list	*node;
+	int		id;
+
+	id = 1;
+	node = shell->jobs;
+	while (node)
+	{
+		id = ft_max(id, ((t_job *)node->content)->id + 1);
+		node = node->next;
+	}
+	job = calloc_tracked(1, sizeof(t_job), UNTRACKED, shell);
+	job->id = id;
+	job->pid = pid;
+	job->text = strdup_tracked(text, UNTRACKED, shell);
+	node = ft_lstnew(job);
+	alloc_check(node, job, shell);
+	ft_lstadd_back(&shell->jobs, node);
+	return (job);
+}
+
+/**
+ * @brief Collects the exit status of a job once its process has exited.
+ *
+ * @param job The job to update.
+ * @param block Whether to wait for the process if it is still running.
+ * @param shell Pointer to the shell structure.
+ * @return Whether the job is done.
+ */
+bool	update_job(t_job *job, bool block, t_shell *shell)
+{
+	t_child	*child;
+	t_child	result;
+
+	if (job->done)
+		return (true);
+	child = find_child(job->pid, shell);
+	if (!child)
+	{
+		job->done = true;
+		return (true);
+	}
+	if (!block && !child->done)
+		return (false);
+	result = await_child(job->pid, shell);
+	job->status = result.status;
+	job->done = true;
+	return (true);
+}
+
+/**
+ * @brief Frees a job record.
+ *
+ * @param data Pointer to the `t_job` to free.
+ */
+void	free_job(void *data)
+{
+	t_job	*job;
+
+	job = (t_job *)data;
+	free(job->text);
+	free(job);
+}
+
+/**
+ * @brief Removes a job from the job table.
+ *
+ * @param job The job to remove.
+ * @param shell Pointer to the shell structure.
+ */
+void	remove_job(t_job *job, t_shell *shell)
+{
+	t_list	*node;
+
+	node = shell->jobs;
+	while (node && node->content != job)
+		node = node->next;
+	if (node)
+		del_node(&node, &shell->jobs, free_job, true);
+}
@@ -0,0 +1,125 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   jobs_second.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:12:21 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:12:21 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Finds a job from a `wait` or `jobs` operand.
+ *
+ * @param spec `%N` for job number N, or the PID of the job's process.
+ * @param shell Pointer to the shell structure.
+ * @return The job, or NULL if no job matches.
+ */
+t_job	*find_job(char *spec, t_shell *shell)
+{
+	t_list	*node;
+	t_job	*job;
+	int		id;
+	pid_t	pid;
+
+	id = 0;
+	pid = 0;
+	if (spec[0] == '%')
+		id = ft_atoi(spec + 1);
+	else
+		pid = ft_atoi(spec);
+	node = shell->jobs;
+	while (node)
+	{
+		job = (t_job *)node->content;
+		if ((id && job->id == id) || (pid && job->pid == pid))
+			return (job);
+		node = node->next;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Returns the marker of a job in listings.
+ *
+ * @param node Node of the job in the job table.
+ * @return '+' for the most recent job, '-' for the one before, ' ' otherwise.
+ */
+char	job_marker(t_list *node)
+{
+	if (!node->next)
+		return ('+');
+	if (!node->next->next)
+		return ('-');
+	return (' ');
+}
+
+/**
+ * @brief Collects the status of every job whose process has exited.
+ *
+ * Does not block: the supervisor reaps what has exited so far.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	refresh_jobs(t_shell *shell)
+{
+	t_list	*node;
+
+	if (!shell->jobs)
+		return ;
+	supervisor_poll(0, shell);
+	node = shell->jobs;
+	while (node)
+	{
+		update_job((t_job *)node->content, false, shell);
+		node = node->next;
+	}
+}
+
+/**
+ * @brief Reports finished jobs before the prompt and forgets them.
+ *
+ * Only an interactive shell reports and forgets finished jobs; otherwise
+ * they are kept until `wait` or `jobs` collects them, so `wait $!` still
+ * returns their status.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	report_jobs(t_shell *shell)
+{
+	t_list		*node;
+	t_list		*next;
+	t_outbuf	out;
+
+	refresh_jobs(shell);
+	if (!isatty(STDIN_FILENO))
+		return ;
+	ft_bzero(&out, sizeof(t_outbuf));
+	node = shell->jobs;
+	while (node)
+	{
+		next = node->next;
+		if (((t_job *)node->content)->done)
+		{
+			format_job(node, &out, shell);
+			del_node(&node, &shell->jobs, free_job, true);
+		}
+		node = next;
+	}
+	if (out.len > 0)
+		outbuf_flush(&out, STDERR_FILENO, shell);
+}
+
+/**
+ * @brief Frees the job table.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	free_jobs(t_shell *shell)
+{
+	ft_lstclear(&shell->jobs, free_job);
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   launch.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:56:13 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:56:13 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Runs an external command and returns its exit status.
+ *
+ * The executable is resolved in the current process first (unless the
+ * parent already did it, see `cmd->exec_path`). A command that cannot be
+ * executed reports 126 or 127 without creating a process, and a successful
+ * lookup fills the caches of the process that will run the next commands.
+ * With OP_TERMINATE the current process is replaced by the program;
+ * otherwise the program is started with `spawn_program` and waited for.
+ *
+ * @param cmd Pointer to the command to run.
+ * @param term_status Whether the current process may be replaced.
+ * @param shell Pointer to the shell structure.
+ * @return The exit status of the command.
+ */
+int	launch_external(t_cmd *cmd, t_op_status term_status, t_shell *shell)
+{
+	int		exec_status;
+	t_stage	stage;
+
+	if (!cmd->exec_path)
+	{
+		exec_status = resolve_executable(cmd->cmd_args[0], &cmd->exec_path,
+				shell);
+		if (exec_status != EXIT_SUCCESS)
+			return (exec_status);
+	}
+	if (term_status == OP_TERMINATE)
+	{
+		keep_proc_substs(cmd->cmd_args, shell);
+		execute_program(cmd->exec_path, cmd->cmd_args,
+			get_ev_array(shell), shell);
+		return (EXIT_FAILURE);
+	}
+	stage = spawn_program(cmd, NULL, shell);
+	if (stage.pid == 0)
+		return (stage.status);
+	wait_for_child(stage.pid, &exec_status, shell);
+	return (handle_exit_signal(exec_status, NULL, shell));
+}
+
+/**
+ * @brief Handles the exit status of a child process, returning the appropriate
+ *        status code.
+ *
+ * This function checks the exit status of a child process. If the process
+ * exited normally, its exit status is returned. If the process was terminated
+ * by a signal, the function writes an error message and, if necessary, adds
+ * a newline to the output. If the signal was SIGQUIT or SIGINT, a newline
+ * is added if it hasn't been added already.
+ *
+ * @param child_status The exit status of the child process.
+ * @param printed_newline Pointer to a flag indicating whether a newline has
+ *                        been added.
+ * @param shell Pointer to the shell structure for managing memory and output.
+ * @return The exit status of the process. If the process was terminated by
+ *         a signal, returns 128 + signal number. If the status does not match
+ *         any of these conditions, returns EXIT_FAILURE.
+ */
+int	handle_exit_signal(int child_status, bool *printed_newline, t_shell *shell)
+{
+	int		exit_signal;
+	bool	need_newline;
+
+	if (!WIFEXITED(child_status))
+	{
+		if (WIFSIGNALED(child_status))
+		{
+			exit_signal = WTERMSIG(child_status);
+			need_newline = (exit_signal == SIGQUIT || exit_signal == SIGINT);
+			if (exit_signal == SIGQUIT)
+				write_and_track("Quit with SIGQUIT (3)", STDERR_FILENO, shell);
+			if (need_newline)
+			{
+				if (!printed_newline || !*printed_newline)
+				{
+					write_and_track("\n", STDERR_FILENO, shell);
+					if (printed_newline)
+						*printed_newline = true;
+				}
+			}
+			return (128 + exit_signal);
+		}
+		return (EXIT_FAILURE);
+	}
+	return (WEXITSTATUS(child_status));
+}
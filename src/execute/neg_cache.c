@@ -0,0 +1,162 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   neg_cache.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:54:27 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:54:27 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Forgets every cached miss and the directory snapshot.
+ *
+ * @param shell Pointer to the shell structure holding the cache.
+ */
+void	neg_cache_clear(t_shell *shell)
+{
+	t_neg_cache	*nc;
+	int			i;
+
+	nc = &shell->neg_cache;
+	i = 0;
+	while (i < NEG_CACHE_SIZE)
+	{
+		free(nc->names[i]);
+		nc->names[i++] = NULL;
+	}
+	free(nc->mtimes);
+	nc->mtimes = NULL;
+	nc->mtime_count = 0;
+	nc->next = 0;
+}
+
+/**
+ * @brief Returns the modification time of a PATH directory.
+ *
+ * Pinned directories are checked with `fstat` on their descriptor; relative
+ * or missing ones with `stat`, so a directory appearing later or a `cd`
+ * with "." in PATH both count as a change.
+ *
+ * @param pd Pointer to the PATH directory cache.
+ * @param i Index of the directory.
+ * @return The modification time, or zero if the directory is missing.
+ */
+static struct timespec	dir_mtime(t_path_dirs *pd, int i)
+{
+	struct stat		info;
+	struct timespec	missing;
+	int				result;
+
+	if (pd->fds[i] != -1)
+		result = fstat(pd->fds[i], &info);
+	else
+		result = stat(pd->dirs[i], &info);
+	if (result == -1)
+	{
+		missing.tv_sec = 0;
+		missing.tv_nsec = 0;
+		return (missing);
+	}
+	return (info.st_mtim);
+}
+
+/**
+ * @brief Compares the PATH directories with the snapshot of the cache.
+ *
+ * @param nc Pointer to the negative cache.
+ * @param pd Pointer to the PATH directory cache.
+ * @return true if any directory was modified since the snapshot.
+ */
+static bool	mtimes_changed(t_neg_cache *nc, t_path_dirs *pd)
+{
+	struct timespec	now;
+	int				i;
+
+	if (nc->mtime_count != pd->count)
+		return (true);
+	i = -1;
+	while (++i < pd->count)
+	{
+		now = dir_mtime(pd, i);
+		if (now.tv_sec != nc->mtimes[i].tv_sec
+			|| now.tv_nsec != nc->mtimes[i].tv_nsec)
+			return (true);
+	}
+	return (false);
+}
+
+/**
+ * @brief Tells whether a command name is a remembered miss.
+ *
+ * The cache is dropped when PATH changed. The directory snapshot is only
+ * re-checked when something that could have created a file ran since the
+ * last check (a child process finished or a redirection created a file),
+ * so a run of repeated misses is answered from memory alone.
+ *
+ * @param name Command name to look up.
+ * @param shell Pointer to the shell structure holding the cache.
+ * @return true if the command is known to be missing from PATH.
+ */
+bool	neg_cache_hit(const char *name, t_shell *shell)
+{
+	t_neg_cache	*nc;
+	int			i;
+
+	nc = &shell->neg_cache;
+	if (!nc->mtimes)
+		return (false);
+	if (nc->path_gen != shell->path_gen || (nc->fs_epoch != shell->fs_epoch
+			&& mtimes_changed(nc, get_path_dirs(shell))))
+	{
+		neg_cache_clear(shell);
+		return (false);
+	}
+	nc->fs_epoch = shell->fs_epoch;
+	i = 0;
+	while (i < NEG_CACHE_SIZE)
+	{
+		if (nc->names[i] && ft_strcmp(nc->names[i], name) == 0)
+			return (true);
+		i++;
+	}
+	return (false);
+}
+
+/**
+ * @brief Remembers that a command name is missing from PATH.
+ *
+ * The first miss takes a snapshot of the PATH directory modification
+ * times. The cache is a ring of NEG_CACHE_SIZE names: the oldest name is
+ * evicted when it is full.
+ *
+ * @param name Command name that was not found.
+ * @param shell Pointer to the shell structure holding the cache.
+ */
+void	neg_cache_add(const char *name, t_shell *shell)
+{
+	t_neg_cache	*nc;
+	t_path_dirs	*pd;
+	int			i;
+
+	nc = &shell->neg_cache;
+	pd = get_path_dirs(shell);
+	if (!nc->mtimes)
+	{
+		nc->mtimes = calloc_tracked(pd->count + 1, sizeof(struct timespec),
+				UNTRACKED, shell);
+		nc->mtime_count = pd->count;
+		i = -1;
+		while (++i < pd->count)
+			nc->mtimes[i] = dir_mtime(pd, i);
+		nc->path_gen = shell->path_gen;
+		nc->fs_epoch = shell->fs_epoch;
+	}
+	free(nc->names[nc->next]);
+	nc->names[nc->next] = strdup_tracked(name, UNTRACKED, shell);
+	nc->next = (nc->next + 1) % NEG_CACHE_SIZE;
+}
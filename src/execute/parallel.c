@@ -0,0 +1,179 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:17:34 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:17:34 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Launches the job of an input in a free slot.
+ *
+ * The job reads from /dev/null and its stdout and stderr go to two memfds
+ * of the slot, so its output can be printed in one piece when it ends.
+ *
+ * @param par The runner.
+ * @param index Index of the input.
+ * @param shell Pointer to the shell structure.
+ * @return 1 if a process was started, 0 if the job failed to launch.
+ */
+static int	launch_job(t_parallel *par, int index, t_shell *shell)
+{
+	t_par_slot	*slot;
+	t_fd_map	map;
+	t_cmd		cmd;
+
+	if (!prepare_job(par, index, &cmd, shell))
+		return (0);
+	slot = par->slots;
+	while (slot->pid)
+		slot++;
+	slot->out = open_capture(shell);
+	slot->err = open_capture(shell);
+	init_fd_map(&map, NULL);
+	map.fds[STDIN_FILENO] = par->null_fd;
+	map.fds[STDOUT_FILENO] = slot->out;
+	map.fds[STDERR_FILENO] = slot->err;
+	par->stages[index] = spawn_program(&cmd, &map, shell);
+	slot->pid = par->stages[index].pid;
+	slot->index = index;
+	if (slot->pid)
+		return (1);
+	close_file(slot->out, shell);
+	close_file(slot->err, shell);
+	return (0);
+}
+
+/**
+ * @brief Waits until one of the running jobs has exited.
+ *
+ * A job whose process has no pidfd cannot wake up the supervisor, so it is
+ * returned at once and waited for directly.
+ *
+ * @param par The runner.
+ * @param shell Pointer to the shell structure.
+ * @return The slot of a job that can be awaited.
+ */
+static t_par_slot	*wait_any_slot(t_parallel *par, t_shell *shell)
+{
+	t_child	*child;
+	int		i;
+
+	while (true)
+	{
+		i = 0;
+		while (i < par->max_jobs)
+		{
+			child = NULL;
+			if (par->slots[i].pid)
+				child = find_child(par->slots[i].pid, shell);
+			if (child && (child->done || child->pidfd == -1))
+				return (&par->slots[i]);
+			i++;
+		}
+		supervisor_poll(-1, shell);
+	}
+}
+
+/**
+ * @brief Collects a finished job and prints its output.
+ *
+ * A job killed by SIGINT counts as a ^C received by the shell.
+ *
+ * @param par The runner.
+ * @param slot Slot of the job.
+ * @param shell Pointer to the shell structure.
+ */
+static void	finish_slot(t_parallel *par, t_par_slot *slot, t_shell *shell)
+{
+	t_child	child;
+
+	child = await_child(slot->pid, shell);
+	par->stages[slot->index].status = job_exit_code(child.status);
+	if (WIFSIGNALED(child.status) && WTERMSIG(child.status) == SIGINT)
+		g_signal = SIGINT;
+	lseek(slot->out, 0, SEEK_SET);
+	lseek(slot->err, 0, SEEK_SET);
+	copy_fd_contents(slot->out, par->io->out);
+	copy_fd_contents(slot->err, par->io->err);
+	close_file(slot->out, shell);
+	close_file(slot->err, shell);
+	slot->pid = 0;
+}
+
+/**
+ * @brief Records the statuses of the jobs and computes the builtin's.
+ *
+ * @param par The runner, with the final status of every job.
+ * @param shell Pointer to the shell structure.
+ * @return 130 after a ^C, 0 if every job succeeded, otherwise the number
+ * of failed jobs, capped at 101.
+ */
+static int	parallel_status(t_parallel *par, t_shell *shell)
+{
+	int	failed;
+	int	i;
+
+	pipeline_status(par->stages, par->count, shell);
+	shell->pipestatus.held = true;
+	failed = 0;
+	i = 0;
+	while (i < par->count)
+	{
+		if (par->stages[i++].status != EXIT_SUCCESS)
+			failed++;
+	}
+	if (failed > 101)
+		failed = 101;
+	if (g_signal == SIGINT)
+		return (128 + SIGINT);
+	return (failed);
+}
+
+/**
+ * @brief Runs the jobs of `parallel` with a concurrency cap.
+ *
+ * Jobs are launched with `posix_spawn` and supervised like the stages of
+ * a pipeline; whenever `max_jobs` of them are running, the shell sleeps in
+ * the supervisor until one exits. Outputs are printed in the order the
+ * jobs end, and statuses are recorded in PIPESTATUS in input order.
+ * After a ^C (see `catch_sigint`), no job is launched any more and the
+ * running ones are only waited for.
+ *
+ * @param par The runner, with its template and inputs.
+ * @param shell Pointer to the shell structure.
+ * @return The exit status of the builtin, or 130 after a ^C.
+ */
+int	run_parallel(t_parallel *par, t_shell *shell)
+{
+	int	status;
+	int	next;
+	int	running;
+
+	if (par->count == 0)
+		return (EXIT_SUCCESS);
+	status = prepare_parallel(par, shell);
+	if (status != EXIT_SUCCESS)
+		return (status);
+	next = 0;
+	running = 0;
+	while (running > 0 || (next < par->count && g_signal != SIGINT))
+	{
+		if (next < par->count && running < par->max_jobs
+			&& g_signal != SIGINT)
+			running += launch_job(par, next++, shell);
+		else
+		{
+			finish_slot(par, wait_any_slot(par, shell), shell);
+			running--;
+		}
+	}
+	close_file(par->null_fd, shell);
+	return (parallel_status(par, shell));
+}
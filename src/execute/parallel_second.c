@@ -0,0 +1,154 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parallel_second.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:17:20 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:17:20 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Replaces every `{}` of a template word with the input.
+ *
+ * @param word Word of the template.
+ * @param input Input of the job.
+ * @param shell Pointer to the shell structure.
+ * @return The substituted word.
+ */
+static char	*substitute_word(char *word, char *input, t_shell *shell)
+{
+	t_outbuf	buf;
+	char		*mark;
+
+	ft_bzero(&buf, sizeof(buf));
+	outbuf_add(&buf, "", 0, shell);
+	mark = ft_strnstr(word, "{}", ft_strlen(word));
+	while (mark)
+	{
+		outbuf_add(&buf, word, mark - word, shell);
+		outbuf_append(&buf, input, shell);
+		word = mark + 2;
+		mark = ft_strnstr(word, "{}", ft_strlen(word));
+	}
+	outbuf_append(&buf, word, shell);
+	return (buf.data);
+}
+
+/**
+ * @brief Builds the argument vector of a job.
+ *
+ * @param par The runner.
+ * @param input Input of the job.
+ * @param shell Pointer to the shell structure.
+ * @return The arguments: the template with `{}` replaced by the input, or
+ * followed by the input if the template has no `{}`.
+ */
+static char	**build_job_argv(t_parallel *par, char *input, t_shell *shell)
+{
+	char	**argv;
+	bool	placed;
+	int		i;
+
+	argv = calloc_tracked(par->tmpl_len + 2, sizeof(char *), COMMAND_TRACK,
+			shell);
+	placed = false;
+	i = 0;
+	while (i < par->tmpl_len)
+	{
+		argv[i] = par->tmpl[i];
+		if (ft_strnstr(argv[i], "{}", ft_strlen(argv[i])))
+		{
+			argv[i] = substitute_word(argv[i], input, shell);
+			placed = true;
+		}
+		i++;
+	}
+	if (!placed)
+		argv[i] = input;
+	return (argv);
+}
+
+/**
+ * @brief Prepares the command of a job.
+ *
+ * The executable resolved by `prepare_parallel` is shared by all jobs;
+ * only a command name built from the input is resolved per job.
+ *
+ * @param par The runner.
+ * @param index Index of the job.
+ * @param cmd Command to fill.
+ * @param shell Pointer to the shell structure.
+ * @return true if the job can be launched; otherwise its status is set.
+ */
+bool	prepare_job(t_parallel *par, int index, t_cmd *cmd, t_shell *shell)
+{
+	int	status;
+
+	ft_bzero(cmd, sizeof(*cmd));
+	cmd->cmd_args = build_job_argv(par, par->inputs[index], shell);
+	cmd->exec_path = par->exec_path;
+	cmd->is_resolved = true;
+	par->stages[index].pid = 0;
+	if (cmd->exec_path)
+		return (true);
+	status = resolve_executable(cmd->cmd_args[0], &cmd->exec_path, shell);
+	par->stages[index].status = status;
+	return (status == EXIT_SUCCESS);
+}
+
+/**
+ * @brief Creates the in-memory file that captures a stream of a job.
+ *
+ * @param shell Pointer to the shell structure.
+ * @return Descriptor of the memfd.
+ */
+int	open_capture(t_shell *shell)
+{
+	int	fd;
+
+	fd = memfd_create("parallel", MFD_CLOEXEC);
+	if (fd == -1)
+		exit_on_sys_error("memfd_create failed", errno, shell);
+	return (fd);
+}
+
+/**
+ * @brief Resolves the command and allocates the state of the runner.
+ *
+ * The command name is looked up once, through the command hash and PATH,
+ * for all the jobs, unless it contains `{}`. At most `max_jobs` jobs run
+ * at once, each holding two memfds and a pidfd, so the cap is lowered to
+ * the number of inputs and to what the descriptor table can hold.
+ *
+ * @param par The runner.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, or the status of the failed lookup.
+ */
+int	prepare_parallel(t_parallel *par, t_shell *shell)
+{
+	int	status;
+
+	par->exec_path = NULL;
+	if (!ft_strnstr(par->tmpl[0], "{}", ft_strlen(par->tmpl[0])))
+	{
+		status = resolve_executable(par->tmpl[0], &par->exec_path, shell);
+		if (status != EXIT_SUCCESS)
+			return (status);
+		par->exec_path = strdup_tracked(par->exec_path, COMMAND_TRACK, shell);
+	}
+	if (par->max_jobs > par->count)
+		par->max_jobs = par->count;
+	if (par->max_jobs > sysconf(_SC_OPEN_MAX) / 8)
+		par->max_jobs = ft_max(sysconf(_SC_OPEN_MAX) / 8, 1);
+	par->stages = calloc_tracked(par->count, sizeof(t_stage), COMMAND_TRACK,
+			shell);
+	par->slots = calloc_tracked(par->max_jobs, sizeof(t_par_slot),
+			COMMAND_TRACK, shell);
+	par->null_fd = open_file("/dev/null", O_RDONLY | O_CLOEXEC, 0, shell);
+	return (EXIT_SUCCESS);
+}
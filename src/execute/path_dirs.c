@@ -0,0 +1,148 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_dirs.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:53:12 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:53:12 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Releases the cached PATH directories and closes their descriptors.
+ *
+ * @param shell Pointer to the shell structure holding the cache.
+ */
+void	free_path_dirs(t_shell *shell)
+{
+	t_path_dirs	*pd;
+	int			i;
+
+	pd = &shell->path_dirs;
+	i = 0;
+	while (pd->dirs && i < pd->count)
+	{
+		if (pd->fds[i] != -1)
+			close(pd->fds[i]);
+		free(pd->dirs[i++]);
+	}
+	free(pd->dirs);
+	free(pd->fds);
+	pd->dirs = NULL;
+	pd->fds = NULL;
+	pd->count = 0;
+}
+
+/**
+ * @brief Splits PATH once and opens every absolute directory.
+ *
+ * Each absolute entry is opened with `O_PATH | O_DIRECTORY`, which pins the
+ * directory without reading it; relative entries (such as ".") keep -1 and
+ * are resolved against the current directory on every probe. Descriptors
+ * are close-on-exec so they never leak into executed programs.
+ *
+ * @param pd Pointer to the cache to fill.
+ * @param shell Pointer to the shell structure for memory management.
+ */
+static void	build_path_dirs(t_path_dirs *pd, t_shell *shell)
+{
+	char	**paths;
+	int		i;
+
+	paths = generate_paths(shell);
+	pd->count = 0;
+	while (paths[pd->count])
+		pd->count++;
+	pd->dirs = calloc_tracked(pd->count + 1, sizeof(char *), UNTRACKED,
+			shell);
+	pd->fds = calloc_tracked(pd->count + 1, sizeof(int), UNTRACKED, shell);
+	i = -1;
+	while (++i < pd->count)
+	{
+		pd->dirs[i] = strdup_tracked(paths[i], UNTRACKED, shell);
+		pd->fds[i] = -1;
+		if (paths[i][0] == '/')
+			pd->fds[i] = raise_fd(open(paths[i], O_PATH | O_DIRECTORY
+						| O_CLOEXEC));
+	}
+	pd->gen = shell->path_gen;
+}
+
+/**
+ * @brief Returns the PATH directory cache, rebuilding it if PATH changed.
+ *
+ * @param shell Pointer to the shell structure holding the cache.
+ * @return Pointer to the up-to-date cache.
+ */
+t_path_dirs	*get_path_dirs(t_shell *shell)
+{
+	t_path_dirs	*pd;
+
+	pd = &shell->path_dirs;
+	if (pd->dirs && pd->gen == shell->path_gen)
+		return (pd);
+	free_path_dirs(shell);
+	build_path_dirs(pd, shell);
+	return (pd);
+}
+
+/**
+ * @brief Checks whether a directory of PATH holds an executable `name`.
+ *
+ * The check is a single `faccessat` relative to the cached directory
+ * descriptor, so no path string is built. An absolute directory that could
+ * not be opened when the cache was built (because it did not exist yet) is
+ * opened again and kept once it appears.
+ *
+ * @param pd Pointer to the PATH directory cache.
+ * @param i Index of the directory to probe.
+ * @param name Name of the executable.
+ * @return 0 if the file is executable, otherwise the errno of the failure.
+ */
+int	probe_path_dir(t_path_dirs *pd, int i, const char *name)
+{
+	int	dir_fd;
+	int	result;
+
+	dir_fd = pd->fds[i];
+	if (dir_fd == -1)
+		dir_fd = raise_fd(open(pd->dirs[i], O_PATH | O_DIRECTORY
+					| O_CLOEXEC));
+	if (dir_fd == -1)
+		return (ENOENT);
+	result = 0;
+	if (faccessat(dir_fd, name, X_OK, 0) == -1)
+		result = errno;
+	if (pd->fds[i] == -1 && pd->dirs[i][0] == '/')
+		pd->fds[i] = dir_fd;
+	else if (pd->fds[i] != dir_fd)
+		close(dir_fd);
+	return (result);
+}
+
+/**
+ * @brief Builds "dir/name" with a single allocation.
+ *
+ * @param dir Directory part.
+ * @param name File name part.
+ * @param shell Pointer to the shell structure for memory management.
+ * @return Tracked string holding the joined path.
+ */
+char	*join_exec_path(const char *dir, const char *name, t_shell *shell)
+{
+	size_t	dir_len;
+	size_t	total_len;
+	char	*full_path;
+
+	dir_len = ft_strlen(dir);
+	total_len = dir_len + ft_strlen(name) + 2;
+	full_path = calloc_tracked(total_len, sizeof(char), COMMAND_TRACK, shell);
+	ft_strlcpy(full_path, dir, total_len);
+	full_path[dir_len] = '/';
+	ft_strlcpy(full_path + dir_len + 1, name, total_len - dir_len - 1);
+	return (full_path);
+}
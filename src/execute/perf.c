@@ -0,0 +1,147 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   perf.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:21:30 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:21:30 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Returns the event counted by a counter of `time -v`.
+ *
+ * @param counter The counter.
+ * @param attr Attributes whose `type` and `config` are set.
+ */
+static void	counter_event(t_counter counter, struct perf_event_attr *attr)
+{
+	attr->type = PERF_TYPE_SOFTWARE;
+	if (counter == CTR_TASK_CLOCK)
+		attr->config = PERF_COUNT_SW_TASK_CLOCK;
+	else if (counter == CTR_CTX_SWITCHES)
+		attr->config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+	else if (counter == CTR_PAGE_FAULTS)
+		attr->config = PERF_COUNT_SW_PAGE_FAULTS;
+	else
+	{
+		attr->type = PERF_TYPE_HARDWARE;
+		attr->config = PERF_COUNT_HW_CPU_CYCLES;
+		if (counter == CTR_INSTRUCTIONS)
+			attr->config = PERF_COUNT_HW_INSTRUCTIONS;
+	}
+}
+
+/**
+ * @brief Opens a counter on the shell, inherited by its future children.
+ *
+ * When `perf_event_paranoid` refuses to count kernel activity, the counter
+ * is opened again for user space only. Hardware events may still be
+ * refused (paranoid level, virtual machine without a PMU): the counter is
+ * then reported as unsupported and the others keep working.
+ *
+ * @param counter The counter to open.
+ * @return Descriptor of the counter, or -1 if it is not available.
+ */
+static int	open_counter(t_counter counter)
+{
+	struct perf_event_attr	attr;
+	int						fd;
+
+	ft_bzero(&attr, sizeof(attr));
+	attr.size = sizeof(attr);
+	counter_event(counter, &attr);
+	attr.inherit = 1;
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED
+		| PERF_FORMAT_TOTAL_TIME_RUNNING;
+	fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, PERF_FLAG_FD_CLOEXEC);
+	if (fd == -1 && (errno == EACCES || errno == EPERM))
+	{
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1,
+				PERF_FLAG_FD_CLOEXEC);
+	}
+	return (fd);
+}
+
+/**
+ * @brief Starts the counters of `time -v`.
+ *
+ * The counters are attached to the shell with `inherit`, so every process
+ * created while they are open (spawned programs, forked stages and their
+ * own children) adds its counts to them when it exits.
+ *
+ * @param fds Storage for the `CTR_COUNT` counter descriptors.
+ */
+void	perf_start(int *fds)
+{
+	int	i;
+
+	i = 0;
+	while (i < CTR_COUNT)
+	{
+		fds[i] = open_counter(i);
+		i++;
+	}
+}
+
+/**
+ * @brief Reads and closes the counters of `time -v`.
+ *
+ * When the kernel had to multiplex the hardware counters, the count is
+ * scaled by the share of time the counter was actually running.
+ *
+ * @param fds Counter descriptors opened by `perf_start`.
+ * @param values Storage for the counts; -1 marks an unsupported counter.
+ */
+void	perf_stop(int *fds, long long *values)
+{
+	uint64_t	data[3];
+	int			i;
+
+	i = 0;
+	while (i < CTR_COUNT)
+	{
+		values[i] = -1;
+		ft_bzero(data, sizeof(data));
+		if (fds[i] != -1 && read(fds[i], data, sizeof(data))
+			== (ssize_t) sizeof(data))
+			values[i] = 0;
+		if (values[i] == 0 && data[2] > 0)
+			values[i] = (long long)((double)data[0] * data[1] / data[2]);
+		if (fds[i] != -1)
+			close(fds[i]);
+		i++;
+	}
+}
+
+/**
+ * @brief Returns the name of a counter in the report of `time -v`.
+ *
+ * @param counter The counter.
+ * @param json Whether the name is a JSON key.
+ * @return The name of the counter.
+ */
+char	*counter_name(t_counter counter, bool json)
+{
+	if (counter == CTR_TASK_CLOCK && json)
+		return ("task_clock_ms");
+	if (counter == CTR_TASK_CLOCK)
+		return ("task-clock");
+	if (counter == CTR_CTX_SWITCHES && json)
+		return ("context_switches");
+	if (counter == CTR_CTX_SWITCHES)
+		return ("context-switches");
+	if (counter == CTR_PAGE_FAULTS && json)
+		return ("page_faults");
+	if (counter == CTR_PAGE_FAULTS)
+		return ("page-faults");
+	if (counter == CTR_CYCLES)
+		return ("cycles");
+	return ("instructions");
+}
@@ -12,73 +12,124 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Completes the fd plan of the next stage.
+ *
+ * A stage that is followed by another one gets the write end of a new pipe
+ * as its stdout, and the read end is kept aside as `spare`: it becomes the
+ * stdin of the next stage and must not stay open in the writer. The last
+ * stage writes to the shell's stdout and no pipe is created for it.
+ *
+ * @param plan Fd plan of the previous stage, whose `spare` read end becomes
+ * the `in` of the next one (-1 for the first stage).
+ * @param has_next Whether another stage follows.
+ * @param shell Pointer to the shell structure.
+ */
+static void	plan_stage(t_fd_plan *plan, bool has_next, t_shell *shell)
+{
+	int	pipe_fds[2];
+
+	plan->in = plan->spare;
+	plan->out = -1;
+	plan->err = -1;
+	plan->spare = -1;
+	if (!has_next)
+		return ;
+	create_pipe(pipe_fds, shell);
+	plan->out = pipe_fds[PIPE_OUTPUT];
+	plan->spare = pipe_fds[PIPE_INPUT];
+}
+
+/**
+ * @brief Closes the parent's copies of the ends handed to a stage.
+ *
+ * @param plan Fd plan of the launched stage.
+ * @param shell Pointer to the shell structure.
+ */
+static void	close_stage_fds(t_fd_plan *plan, t_shell *shell)
+{
+	if (plan->in != -1)
+		close_file(plan->in, shell);
+	if (plan->out != -1)
+		close_file(plan->out, shell);
+}
+
 /**
  * @brief Executes a sequence of commands connected by pipes.
  *
- * This function creates pipes, executes each command in the command list,
- * and waits for all child processes to complete. It uses file descriptors to
- * pass data between commands in the pipeline.
+ * Exactly one close-on-exec pipe is created between each pair of adjacent
+ * stages, right before the stage that writes into it. Each stage receives
+ * its fd plan, and the parent closes the stage's ends as soon as the stage
+ * is launched, so the parent never holds more than three pipe descriptors
+ * whatever the length of the pipeline. A stage whose command cannot be
+ * executed creates no process and keeps the status of the failure. The
+ * first stage that is a state-free builtin call creates no process either:
+ * it runs inside the shell once all the other stages are launched.
  *
  * @param pipe_lst Pointer to the list of commands to be executed in 
  * the pipeline.
  * @param shell Pointer to the shell structure for process management.
- * @return The exit code of the last command in the pipeline.
+ * @return The exit status of the pipeline (see `pipeline_status`).
  */
 int	execute_command_chain(t_list *pipe_lst, t_shell *shell)
 {
-	int		pipe_fds[2];
-	int		last_pipe_fd;
-	pid_t	last_exec_pid;
-	t_list	*current;
+	t_fd_plan		plan;
+	t_inline_stage	inl;
+	t_stage			*stages;
+	int				i;
 
-	last_exec_pid = 0;
-	last_pipe_fd = -1;
-	current = pipe_lst;
-	while (current)
+	stages = calloc_tracked(ft_lstsize(pipe_lst), sizeof(t_stage),
+			COMMAND_TRACK, shell);
+	i = 0;
+	plan.spare = -1;
+	inl.node = NULL;
+	while (pipe_lst)
 	{
-		create_pipe(pipe_fds, shell);
-		last_exec_pid = run_pipe_cmd(current, last_pipe_fd, pipe_fds,
-				shell);
-		if (last_pipe_fd != -1)
-			close_file(last_pipe_fd, shell);
-		close_file(pipe_fds[PIPE_OUTPUT], shell);
-		last_pipe_fd = pipe_fds[PIPE_INPUT];
-		current = current->next;
+		plan_stage(&plan, pipe_lst->next != NULL, shell);
+		stages[i] = run_pipe_cmd(pipe_lst->content, &plan, &inl, shell);
+		if (stages[i].pid == -1)
+			inl.index = i;
+		else
+			close_stage_fds(&plan, shell);
+		pipe_lst = pipe_lst->next;
+		i++;
 	}
-	return (collect_child_statuses(last_exec_pid, ft_lstsize(pipe_lst), shell));
+	if (inl.node)
+		stages[inl.index] = run_inline_stage(&inl, shell);
+	collect_child_statuses(stages, i, shell);
+	return (pipeline_status(stages, i, shell));
 }
+
 /**
- * @brief Collects and returns the final exit status of all pipeline processes.
+ * @brief Waits for the processes of a pipeline and stores their statuses.
  *
- * This function waits for all pipeline processes to complete, processes their
- * exit status, and returns the exit status of the last executed process.
- * Additional messages and newlines are handled when processing signal statuses.
+ * Each stage's own PID is waited for with `waitpid`, so no other child of
+ * the shell is reaped by mistake. The exit status of every stage that
+ * created a process replaces its `status`. Additional messages and newlines
+ * are handled when processing signal statuses.
  *
- * @param last_exec_pid PID of the last executed process.
- * @param pipe_count Number of processes in the pipeline.
+ * @param stages Stages of the pipeline, in order.
+ * @param count Number of stages.
  * @param shell Pointer to the shell structure for memory and signal management.
- * @return The final exit status of the last executed process.
  */
-
-int	collect_child_statuses(pid_t last_exec_pid, int pipe_count, t_shell *shell)
+void	collect_child_statuses(t_stage *stages, int count, t_shell *shell)
 {
 	bool	need_newline;
-	int		sig_status;
-	int		exit_status;
-	int		result;
-	pid_t	current_pid;
+	int		raw_status;
+	int		i;
 
 	need_newline = false;
-	result = 0;
-	while (pipe_count > 0)
+	i = 0;
+	while (i < count)
 	{
-		current_pid = wait_for_child(&sig_status, shell);
-		exit_status = handle_exit_signal(sig_status, &need_newline, shell);
-		if (current_pid == last_exec_pid)
-			result = exit_status;
-		pipe_count--;
+		if (stages[i].pid > 0)
+		{
+			wait_for_child(stages[i].pid, &raw_status, shell);
+			stages[i].status = handle_exit_signal(raw_status, &need_newline,
+					shell);
+		}
+		i++;
 	}
-	return (result);
 }
 
 /**
@@ -112,46 +163,3 @@ int	process_pipeline(t_ast *ast_node, t_shell *shell)
 	status = execute_command_chain(commands, shell);
 	return (status);
 }
-
-/**
- * @brief Executes a single command in the pipeline.
- *
- * This function executes one command in the pipeline by creating a new process
- * using `create_process`. In the child process, input/output streams are 
- * redirected
- * to create pipes, and then the command is executed. The parent process returns
- * the PID of the child process.
- *
- * @param pipe_lst Pointer to the list of pipeline commands.
- * @param last_pipe_fd Read descriptor from the previous pipe.
- * @param pipe_fds Array of two descriptors for the current pipe.
- * @param shell Pointer to the shell structure for state management.
- * @return PID of the child process executing the command.
- */
-pid_t	run_pipe_cmd(t_list *pipe_lst, int last_pipe_fd,
-		int pipe_fds[2], t_shell *shell)
-{
-	pid_t	last_exec_pid;
-	t_ast	*current_ast;
-	bool	is_not_last_command;
-
-	current_ast = (t_ast *)pipe_lst->content;
-	last_exec_pid = create_process(shell);
-	if (last_exec_pid == 0)
-	{
-		shell->is_main = false;
-		signals_default();
-		if (last_pipe_fd != -1)
-		{
-			duplicate_fd(last_pipe_fd, STDIN_FILENO, shell);
-			close_file(last_pipe_fd, shell);
-		}
-		is_not_last_command = (pipe_lst->next != NULL);
-		if (is_not_last_command)
-			duplicate_fd(pipe_fds[PIPE_OUTPUT], STDOUT_FILENO, shell);
-		close_file(pipe_fds[PIPE_INPUT], shell);
-		close_file(pipe_fds[PIPE_OUTPUT], shell);
-		run_cmd(current_ast, OP_TERMINATE, shell);
-	}
-	return (last_exec_pid);
-}
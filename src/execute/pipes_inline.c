@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipes_inline.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:23:56 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:23:56 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Closes the pipe ends held for a builtin stage, if any.
+ *
+ * In a forked child, the ends belong to the parent's stage and must not
+ * keep the pipes open; in the parent, they are released once the stage
+ * has run.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	release_held_fds(t_shell *shell)
+{
+	if (shell->held_fds[0] != -1)
+		close(shell->held_fds[0]);
+	if (shell->held_fds[1] != -1)
+		close(shell->held_fds[1]);
+	shell->held_fds[0] = -1;
+	shell->held_fds[1] = -1;
+}
+
+/**
+ * @brief Keeps a pipeline stage aside to run it inside the shell.
+ *
+ * Only a simple command that is a state-free builtin call qualifies. Its
+ * pipe ends stay open in the shell until it runs, after every other stage
+ * has been launched, and are marked as held so that forked stages close
+ * them.
+ *
+ * @param inl Storage for the held stage.
+ * @param node AST node of the stage.
+ * @param plan Fd plan of the stage.
+ * @param shell Pointer to the shell structure.
+ * @return true if the stage was kept aside.
+ */
+bool	hold_inline_stage(t_inline_stage *inl, t_ast *node, t_fd_plan *plan,
+		t_shell *shell)
+{
+	if (node->node_type != CMD)
+		return (false);
+	resolve_ast_content(node, shell);
+	if (!is_pure_builtin(&node->u_node_cont.cmd))
+		return (false);
+	inl->node = node;
+	inl->plan = *plan;
+	shell->held_fds[0] = plan->in;
+	shell->held_fds[1] = plan->out;
+	return (true);
+}
+
+/**
+ * @brief Runs a held builtin stage inside the shell.
+ *
+ * The reader of its output already exists, so the builtin cannot block on
+ * a full pipe. The pipe ends are handed to it as its I/O context, so the
+ * shell's own streams stay in place; `cat` reads the input end. SIGPIPE
+ * is ignored meanwhile: when the reader is gone, the writes fail with
+ * EPIPE and the stage gets the status a forked builtin killed by SIGPIPE
+ * would have had. SIGINT is caught (see `catch_sigint`), so that a stage
+ * reading a terminal, such as the `cat` of `cat | wc -l`, stops on ^C
+ * like the other stages.
+ *
+ * @param inl The held stage.
+ * @param shell Pointer to the shell structure.
+ * @return The stage, with no PID and the status of the builtin.
+ */
+t_stage	run_inline_stage(t_inline_stage *inl, t_shell *shell)
+{
+	t_stage	stage;
+	t_cmd	*cmd;
+	t_io	io;
+
+	conf_signal(SIGPIPE, SIG_IGN);
+	catch_sigint(shell);
+	cmd = &inl->node->u_node_cont.cmd;
+	init_io(&io, &inl->plan);
+	shell->broken_pipe = false;
+	stage.pid = 0;
+	stage.status = run_builtin(fetch_builtin_cmd(cmd->cmd_args[0]), cmd,
+			&io, shell);
+	if (shell->broken_pipe)
+		stage.status = 128 + SIGPIPE;
+	conf_signal(SIGPIPE, SIG_DFL);
+	release_sigint(shell);
+	release_held_fds(shell);
+	release_proc_substs(inl->node, shell);
+	return (stage);
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipes_second.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:59:51 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:59:51 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Prepares a pipeline stage in the parent before it is forked.
+ *
+ * For a simple command, the arguments are expanded and the executable is
+ * resolved here, so the lookup reaches the caches of the main shell and a
+ * command that cannot be executed is reported without forking.
+ *
+ * @param stage AST node of the pipeline stage.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, or the exit status of the failed lookup.
+ */
+static int	prepare_stage(t_ast *stage, t_shell *shell)
+{
+	t_cmd	*cmd;
+
+	if (stage->node_type != CMD)
+		return (EXIT_SUCCESS);
+	resolve_ast_content(stage, shell);
+	cmd = &stage->u_node_cont.cmd;
+	if (!cmd->cmd_args[0] || fetch_builtin_cmd(cmd->cmd_args[0]))
+		return (EXIT_SUCCESS);
+	return (resolve_executable(cmd->cmd_args[0], &cmd->exec_path, shell));
+}
+
+/**
+ * @brief Forks a process that runs a pipeline stage as shell code.
+ *
+ * Used for stages that need the shell itself: builtins and subshells.
+ * Close-on-exec does not apply to a fork, so the child applies its fd plan
+ * by hand: the plan's ends are moved onto stdin/stdout and the spare read
+ * end of its own output pipe is closed.
+ *
+ * @param node AST node of the pipeline stage.
+ * @param plan Fd plan of the stage.
+ * @param shell Pointer to the shell structure for state management.
+ * @return PID of the child process.
+ */
+static pid_t	fork_stage(t_ast *node, t_fd_plan *plan, t_shell *shell)
+{
+	pid_t	pid;
+
+	pid = create_process(shell);
+	if (pid == 0)
+	{
+		shell->is_main = false;
+		signals_child(shell);
+		if (plan->in != -1)
+		{
+			duplicate_fd(plan->in, STDIN_FILENO, shell);
+			close_file(plan->in, shell);
+		}
+		if (plan->out != -1)
+		{
+			duplicate_fd(plan->out, STDOUT_FILENO, shell);
+			close_file(plan->out, shell);
+		}
+		if (plan->spare != -1)
+			close_file(plan->spare, shell);
+		run_cmd(node, OP_TERMINATE, shell);
+	}
+	return (pid);
+}
+
+/**
+ * @brief Launches a pipeline stage that is not held.
+ *
+ * An external command is started with `spawn_program`, which applies the
+ * fd plan through file actions, and so is one with redirections (see
+ * `spawn_redirected`); any other stage is forked with `fork_stage`.
+ *
+ * @param node AST node of the pipeline stage.
+ * @param plan Fd plan of the stage.
+ * @param shell Pointer to the shell structure for state management.
+ * @return The stage: PID of the child process, or 0 with the status of
+ * the failed lookup or launch.
+ */
+static t_stage	launch_stage(t_ast *node, t_fd_plan *plan, t_shell *shell)
+{
+	t_stage		stage;
+	t_fd_map	map;
+
+	if (redirects_external(node, shell))
+		return (spawn_redirected(node, plan, shell));
+	stage.pid = 0;
+	stage.status = prepare_stage(node, shell);
+	if (stage.status != EXIT_SUCCESS)
+		return (stage);
+	init_fd_map(&map, plan);
+	if (node->node_type == CMD && node->u_node_cont.cmd.exec_path)
+		return (spawn_program(&node->u_node_cont.cmd, &map, shell));
+	stage.pid = fork_stage(node, plan, shell);
+	return (stage);
+}
+
+/**
+ * @brief Executes a single command in the pipeline.
+ *
+ * The stage is prepared in the parent first. If its command cannot be
+ * executed, no process is created and the failure status is returned;
+ * otherwise it is launched by `launch_stage`, and the shell closes its
+ * ends of the process substitutions the stage names. The first
+ * state-free builtin call is held instead, to run inside the shell (see
+ * `run_inline_stage`).
+ *
+ * @param node AST node of the pipeline stage.
+ * @param plan Fd plan of the stage.
+ * @param inl Builtin stage held by the pipeline, if any.
+ * @param shell Pointer to the shell structure for state management.
+ * @return The stage: PID of the child process, 0 with the status of
+ * the failed lookup or launch, or -1 if the stage was held.
+ */
+t_stage	run_pipe_cmd(t_ast *node, t_fd_plan *plan, t_inline_stage *inl,
+		t_shell *shell)
+{
+	t_stage		stage;
+
+	stage.pid = -1;
+	stage.status = EXIT_SUCCESS;
+	if (!inl->node && hold_inline_stage(inl, node, plan, shell))
+		return (stage);
+	stage = launch_stage(node, plan, shell);
+	release_proc_substs(node, shell);
+	return (stage);
+}
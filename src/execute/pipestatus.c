@@ -0,0 +1,86 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipestatus.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:06:33 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:06:33 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Makes room for `count` statuses in PIPESTATUS.
+ *
+ * @param count Number of statuses that will be recorded.
+ * @param shell Pointer to the shell structure.
+ */
+static void	reserve_pipestatus(int count, t_shell *shell)
+{
+	t_pipestatus	*ps;
+
+	ps = &shell->pipestatus;
+	if (count <= ps->cap)
+		return ;
+	free(ps->codes);
+	ps->codes = NULL;
+	ps->cap = ft_max(count, 8);
+	ps->codes = calloc_tracked(ps->cap, sizeof(int), UNTRACKED, shell);
+}
+
+/**
+ * @brief Records the status of a command run as a whole pipeline.
+ *
+ * A simple command, a redirection or a subshell run outside of a pipe is a
+ * one-stage pipeline: PIPESTATUS then holds its status only. A builtin
+ * that records statuses of its own (`parallel`) holds them, and they are
+ * kept instead.
+ *
+ * @param status Exit status of the command.
+ * @param shell Pointer to the shell structure.
+ */
+void	record_status(int status, t_shell *shell)
+{
+	if (shell->pipestatus.held)
+	{
+		shell->pipestatus.held = false;
+		return ;
+	}
+	reserve_pipestatus(1, shell);
+	shell->pipestatus.codes[0] = status;
+	shell->pipestatus.count = 1;
+}
+
+/**
+ * @brief Records the statuses of every stage and computes the pipeline's.
+ *
+ * The statuses are kept in PIPESTATUS in stage order. The status of the
+ * pipeline is the status of its last stage, or, with the `pipefail` option,
+ * the status of the rightmost stage that failed (0 if none did).
+ *
+ * @param stages Stages of the pipeline, with their final statuses.
+ * @param count Number of stages.
+ * @param shell Pointer to the shell structure.
+ * @return The exit status of the pipeline.
+ */
+int	pipeline_status(t_stage *stages, int count, t_shell *shell)
+{
+	int	result;
+	int	i;
+
+	reserve_pipestatus(count, shell);
+	result = stages[count - 1].status;
+	i = 0;
+	while (i < count)
+	{
+		shell->pipestatus.codes[i] = stages[i].status;
+		if (shell->pipefail && stages[i].status != EXIT_SUCCESS)
+			result = stages[i].status;
+		i++;
+	}
+	shell->pipestatus.count = count;
+	return (result);
+}
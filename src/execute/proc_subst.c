@@ -0,0 +1,164 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   proc_subst.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:50:59 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:50:59 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Parses the command line inside a substitution.
+ *
+ * @param text The command line, without its parentheses.
+ * @param shell Pointer to the shell structure.
+ * @return The syntax tree, or NULL if it is empty or has a syntax error
+ * (already reported).
+ */
+t_ast	*parse_command_text(char *text, t_shell *shell)
+{
+	t_list	*tokens;
+	t_ast	*tree;
+
+	tree = NULL;
+	if (tokenize_input(text, &tokens, shell) != EXIT_SUCCESS || !tokens)
+		return (NULL);
+	if (parse_tokens(tokens, &tree, shell) != EXIT_SUCCESS)
+		return (NULL);
+	return (tree);
+}
+
+/**
+ * @brief Runs the command of a process substitution in a child process.
+ *
+ * The child closes the shell's end of its own pipe and those of the
+ * substitutions started before it, so a `>(...)` reader run as shell
+ * code, such as the `cat` builtin, is not kept from seeing the end of its
+ * input.
+ *
+ * @param tree The command.
+ * @param fds The pipe; its end `fds[is_input]` becomes stdout for
+ * `<(...)` and stdin otherwise.
+ * @param is_input Whether the substitution is `<(...)`.
+ * @param shell Pointer to the shell structure.
+ * @return The PID of the child.
+ */
+static pid_t	fork_subst(t_ast *tree, int *fds, bool is_input, t_shell *shell)
+{
+	pid_t	pid;
+	t_list	*node;
+
+	pid = create_process(shell);
+	if (pid != 0)
+		return (pid);
+	shell->is_main = false;
+	signals_child(shell);
+	node = shell->proc_substs;
+	while (node)
+	{
+		if (((t_proc_subst *)node->content)->fd != -1)
+			close(((t_proc_subst *)node->content)->fd);
+		node = node->next;
+	}
+	shell->proc_substs = NULL;
+	close(fds[!is_input]);
+	if (is_input)
+		duplicate_fd(fds[is_input], STDOUT_FILENO, shell);
+	else
+		duplicate_fd(fds[is_input], STDIN_FILENO, shell);
+	run_cmd(tree, OP_TERMINATE, shell);
+	return (0);
+}
+
+/**
+ * @brief Starts a process substitution and returns the path standing for
+ * it.
+ *
+ * The command is connected to a pipe; the shell keeps the other end,
+ * close-on-exec, until the command naming it is launched (see
+ * `release_proc_substs`), so the data streams between the processes
+ * without touching the file system and only that command inherits it.
+ *
+ * @param word The word, `<(...)` or `>(...)`.
+ * @param shell Pointer to the shell structure.
+ * @return `/dev/fd/N`, where N is the end of the pipe kept by the shell.
+ */
+static char	*start_proc_subst(char *word, t_shell *shell)
+{
+	t_proc_subst	*subst;
+	int				fds[2];
+	bool			is_input;
+	t_ast			*tree;
+	char			*text;
+
+	text = manage_memory(ft_substr(word, 2, ft_strrchr(word, ')') - word - 2),
+			COMMAND_TRACK, shell);
+	tree = parse_command_text(text, shell);
+	is_input = (word[0] == '<');
+	create_pipe(fds, shell);
+	subst = calloc_tracked(1, sizeof(t_proc_subst), COMMAND_TRACK, shell);
+	subst->pid = fork_subst(tree, fds, is_input, shell);
+	subst->fd = fds[!is_input];
+	close(fds[is_input]);
+	lstadd_back_tracked(subst, &shell->proc_substs, COMMAND_TRACK, shell);
+	return (strjoin_tracked("/dev/fd/", manage_memory(ft_itoa(subst->fd),
+				COMMAND_TRACK, shell), COMMAND_TRACK, shell));
+}
+
+/**
+ * @brief Expands a word, which may be a process substitution.
+ *
+ * An unquoted word starting with `<(` or `>(` starts its command and
+ * becomes a single path (see `start_proc_subst`); any other word is
+ * expanded by `resolve_arg`.
+ *
+ * @param word The word.
+ * @param words List the resulting words are appended to.
+ * @param shell Pointer to the shell structure.
+ */
+void	resolve_word(char *word, t_list **words, t_shell *shell)
+{
+	if ((word[0] == '<' || word[0] == '>') && word[1] == '(')
+		lstadd_back_tracked(start_proc_subst(word, shell), words,
+			COMMAND_TRACK, shell);
+	else
+		resolve_arg(word, words, shell);
+}
+
+/**
+ * @brief Ends the process substitutions of a command line.
+ *
+ * The shell's ends of the pipes still open (those of substitutions no
+ * launched command named) are closed, so `<(...)` writers get
+ * SIGPIPE and `>(...)` readers see the end of their input, and the
+ * commands are waited for: none outlives the line that started it.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	finish_proc_substs(t_shell *shell)
+{
+	t_list			*node;
+	t_proc_subst	*subst;
+	int				raw_status;
+
+	node = shell->proc_substs;
+	while (node)
+	{
+		if (((t_proc_subst *)node->content)->fd != -1)
+			close(((t_proc_subst *)node->content)->fd);
+		node = node->next;
+	}
+	node = shell->proc_substs;
+	while (node)
+	{
+		subst = node->content;
+		wait_for_child(subst->pid, &raw_status, shell);
+		node = node->next;
+	}
+	shell->proc_substs = NULL;
+}
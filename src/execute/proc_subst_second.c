@@ -0,0 +1,127 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   proc_subst_second.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:29:26 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 01:29:26 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Finds the process substitution an argument stands for.
+ *
+ * @param arg An argument of a command.
+ * @param shell Pointer to the shell structure.
+ * @return The substitution whose `/dev/fd/N` path is `arg`, if its end
+ * of the pipe is still open in the shell, or NULL.
+ */
+static t_proc_subst	*named_subst(char *arg, t_shell *shell)
+{
+	t_list	*node;
+	int		fd;
+	int		i;
+
+	if (ft_strncmp(arg, "/dev/fd/", 8) || !ft_isdigit(arg[8]))
+		return (NULL);
+	fd = 0;
+	i = 8;
+	while (ft_isdigit(arg[i]) && i < 16)
+		fd = fd * 10 + arg[i++] - '0';
+	if (arg[i])
+		return (NULL);
+	node = shell->proc_substs;
+	while (node)
+	{
+		if (((t_proc_subst *)node->content)->fd == fd)
+			return (node->content);
+		node = node->next;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Passes the process substitutions named by a command to the
+ * program spawned for it.
+ *
+ * The shell's ends of the pipes are close-on-exec; a `dup2` action onto
+ * the descriptor itself clears the flag in the program only, so no other
+ * command of the line inherits them.
+ *
+ * @param actions File actions of the program.
+ * @param args Arguments of the command.
+ * @param shell Pointer to the shell structure.
+ * @return 0 on success, or an error number.
+ */
+int	add_proc_subst_fds(posix_spawn_file_actions_t *actions, char **args,
+		t_shell *shell)
+{
+	t_proc_subst	*subst;
+	int				err;
+
+	err = 0;
+	while (!err && *args)
+	{
+		subst = named_subst(*args++, shell);
+		if (subst)
+			err = posix_spawn_file_actions_adddup2(actions, subst->fd,
+					subst->fd);
+	}
+	return (err);
+}
+
+/**
+ * @brief Keeps the process substitutions named by a command open across
+ * `execve`, in a process about to be replaced by it.
+ *
+ * @param args Arguments of the command.
+ * @param shell Pointer to the shell structure.
+ */
+void	keep_proc_substs(char **args, t_shell *shell)
+{
+	t_proc_subst	*subst;
+
+	while (*args)
+	{
+		subst = named_subst(*args++, shell);
+		if (subst)
+			fcntl(subst->fd, F_SETFD, 0);
+	}
+}
+
+/**
+ * @brief Closes the shell's ends of the process substitutions named by a
+ * command once it has been launched.
+ *
+ * The command holds its own copies, so a `>(...)` reader sees the end of
+ * its input as soon as the command is done with it. The substitutions are
+ * still waited for by `finish_proc_substs`.
+ *
+ * @param node AST node of the command, or of its redirections.
+ * @param shell Pointer to the shell structure.
+ */
+void	release_proc_substs(t_ast *node, t_shell *shell)
+{
+	t_proc_subst	*subst;
+	char			**args;
+
+	if (node->node_type == REDIR)
+		node = redir_target(node);
+	if (!shell->proc_substs || !node || node->node_type != CMD
+		|| !node->u_node_cont.cmd.is_resolved)
+		return ;
+	args = node->u_node_cont.cmd.cmd_args;
+	while (*args)
+	{
+		subst = named_subst(*args++, shell);
+		if (subst)
+		{
+			close(subst->fd);
+			subst->fd = -1;
+		}
+	}
+}
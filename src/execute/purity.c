@@ -0,0 +1,80 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   purity.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:26:06 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:26:06 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Tells whether a word is the same before and after expansion.
+ *
+ * @param word A raw word of the command line.
+ * @return true if the word has no quotes, variables or wildcards.
+ */
+static bool	is_static_word(char *word)
+{
+	while (*word)
+	{
+		if (ft_strchr("$'\"*\\", *word))
+			return (false);
+		word++;
+	}
+	return (true);
+}
+
+/**
+ * @brief Tells whether a simple command leaves the shell state untouched.
+ *
+ * The check runs before expansion, so it is conservative: a command name
+ * that is not a plain word could expand to any builtin, and any raw
+ * argument of `export`, `hash` or `set` (even one that expands to nothing)
+ * counts as a change.
+ *
+ * @param cmd The command, not yet expanded.
+ * @return true if the command is external or a state-free builtin call.
+ */
+static bool	is_pure_cmd(t_cmd *cmd)
+{
+	if (!cmd->cmd_args[0])
+		return (true);
+	if (!cmd->is_resolved && !is_static_word(cmd->cmd_args[0]))
+		return (false);
+	if (!fetch_builtin_cmd(cmd->cmd_args[0]))
+		return (true);
+	return (is_pure_builtin(cmd));
+}
+
+/**
+ * @brief Proves that running a tree inside the shell changes no state.
+ *
+ * Stages of a pipeline run in their own processes (or, for a state-free
+ * builtin, inside the shell), and a nested subshell makes the same choice
+ * for itself, so both are always safe. Logical lists, redirections and
+ * `time` are safe when their commands are. A background job is not: it
+ * would enter the shell's job table and `$!`.
+ *
+ * @param node Root of the tree, or NULL.
+ * @return true if the tree can run without a subshell.
+ */
+bool	is_pure_ast(t_ast *node)
+{
+	if (!node || node->node_type == PIPE || node->node_type == BRACE)
+		return (true);
+	if (node->node_type == CMD)
+		return (is_pure_cmd(&node->u_node_cont.cmd));
+	if (node->node_type == LOGIC)
+		return (is_pure_ast(node->u_node_cont.logic.first)
+			&& is_pure_ast(node->u_node_cont.logic.second));
+	if (node->node_type == REDIR)
+		return (is_pure_ast(node->u_node_cont.redir.command));
+	if (node->node_type == TIME)
+		return (is_pure_ast(node->u_node_cont.timed.command));
+	return (false);
+}
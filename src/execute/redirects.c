@@ -13,101 +13,128 @@
 #include "minishell.h"
 
 /**
- * @brief Handles input redirection.
+ * @brief Starts an external command with its redirections.
  *
- * This function opens a file for reading, saves the current stdin,
- * redirects stdin to the opened file, executes the command, restores
- * the original stdin, and closes the file. If the file cannot be opened,
- * it returns an error code.
+ * The files are opened by the shell, close-on-exec, and the resulting fd
+ * map is handed to the program as spawn file actions on top of the base
+ * plan (the pipes of a pipeline stage), so no stream of the shell is
+ * duplicated or restored. A file that cannot be opened or a command that
+ * cannot be executed creates no process.
  *
- * @param redirect The redirection structure containing file and command 
- * information.
- * @param shell Pointer to the shell structure for process management.
- * @return The exit code of the command or an error code.
+ * @param node Outermost REDIR node around an external command.
+ * @param base Fd plan of the stage, or NULL outside of a pipeline.
+ * @param shell Pointer to the shell structure.
+ * @return The stage: PID of the program, or 0 with the failure status.
  */
-int	process_input_redirection(t_redir *redirect, t_shell *shell)
+t_stage	spawn_redirected(t_ast *node, t_fd_plan *base, t_shell *shell)
 {
-	int		fd;
-	int		exit_code;
-	int		stdin_temp;
-	bool	success;
+	t_fd_map	map;
+	t_cmd		*cmd;
+	t_stage		stage;
 
-	fd = open(redirect->filename, O_RDONLY);
-	success = (fd != -1);
-	if (success)
-	{
-		stdin_temp = dup(STDIN_FILENO);
-		success = (duplicate_fd(fd, STDIN_FILENO, shell) != -1);
-		close_file(fd, shell);
-	}
-	if (success)
-	{
-		exit_code = run_cmd(redirect->command, OP_COMPLETE, shell);
-		duplicate_fd(stdin_temp, STDIN_FILENO, shell);
-		close_file(stdin_temp, shell);
-	}
-	else
-		exit_code = error_msg_errno(redirect->filename, shell);
-	return (exit_code);
+	cmd = &redir_target(node)->u_node_cont.cmd;
+	stage.pid = 0;
+	stage.status = build_fd_map(node, base, &map, shell);
+	if (stage.status != EXIT_SUCCESS)
+		return (stage);
+	if (!cmd->exec_path)
+		stage.status = resolve_executable(cmd->cmd_args[0], &cmd->exec_path,
+				shell);
+	if (stage.status == EXIT_SUCCESS)
+		stage = spawn_program(cmd, &map, shell);
+	release_fd_map(&map);
+	return (stage);
 }
 
 /**
- * @brief Handles output redirection.
+ * @brief Replaces the current process by an external command with its
+ * redirections.
  *
- * This function opens a file for writing (creating or appending), 
- * saves the current stdout, redirects stdout to the opened file, 
- * executes the command, restores the original stdout, and closes 
- * the file. 
- * If the file cannot be opened, it returns an error code.
+ * Only used where the process is about to end anyway (a forked stage or
+ * job), so the fd operations are applied to its own descriptors.
  *
- * @param redirect The redirection structure containing file and command 
- * information.
- * @param shell Pointer to the shell structure for process management.
+ * @param node Outermost REDIR node around an external command.
+ * @param shell Pointer to the shell structure.
+ * @return The failure status, if the command could not be started.
+ */
+static int	exec_redirected(t_ast *node, t_shell *shell)
+{
+	t_fd_map	map;
+	t_fd_step	steps[FD_MAP_SIZE];
+	int			status;
+
+	status = build_fd_map(node, NULL, &map, shell);
+	if (status != EXIT_SUCCESS)
+		return (status);
+	apply_fd_steps(&map, steps, schedule_fd_map(&map, steps, shell),
+		shell);
+	return (launch_external(&redir_target(node)->u_node_cont.cmd,
+			OP_TERMINATE, shell));
+}
+
+/**
+ * @brief Runs a compound command (a subshell) with its redirections.
+ *
+ * The fd operations of the chain are applied to the shell's own
+ * descriptors around the command, and the descriptors they overwrite are
+ * saved and restored afterwards. The shell keeps none of its own
+ * descriptors in the range a redirection can name (see `raise_fd`).
+ *
+ * @param node Outermost REDIR node.
+ * @param shell Pointer to the shell structure.
  * @return The exit code of the command or an error code.
  */
-int	process_output_redirection(t_redir *redirect, t_shell *shell)
+static int	redirect_compound(t_ast *node, t_shell *shell)
 {
-	int		fd;
-	int		exit_code;
-	int		stdout_temp;
-	bool	success;
+	t_fd_map	map;
+	t_fd_step	steps[FD_MAP_SIZE];
+	int			saved[FD_MAP_SIZE];
+	int			count;
+	int			status;
 
-	if (redirect->redir_type == T_OUTPUT)
-		fd = open(redirect->filename, O_CREAT | O_WRONLY | O_TRUNC, 0644);
-	else
-		fd = open(redirect->filename, O_CREAT | O_WRONLY | O_APPEND, 0644);
-	success = (fd != -1);
-	if (success)
-	{
-		stdout_temp = dup(STDOUT_FILENO);
-		success = (duplicate_fd(fd, STDOUT_FILENO, shell) != -1);
-		close_file(fd, shell);
-	}
-	if (success)
-	{
-		exit_code = run_cmd(redirect->command, OP_COMPLETE, shell);
-		duplicate_fd(stdout_temp, STDOUT_FILENO, shell);
-		close_file(stdout_temp, shell);
-	}
-	else
-		exit_code = error_msg_errno(redirect->filename, shell);
-	return (exit_code);
+	status = build_fd_map(node, NULL, &map, shell);
+	if (status != EXIT_SUCCESS)
+		return (status);
+	count = schedule_fd_map(&map, steps, shell);
+	save_fd_targets(&map, steps, count, saved);
+	apply_fd_steps(&map, steps, count, shell);
+	status = run_cmd(redir_target(node), OP_COMPLETE, shell);
+	restore_fd_targets(steps, count, saved, shell);
+	release_fd_map(&map);
+	return (status);
 }
 
 /**
- * @brief Handles input or output redirection.
+ * @brief Runs a command with its redirections.
  *
- * This function determines the type of redirection (input or output) 
- * and calls the appropriate function to handle the redirection.
+ * A chain of redirections becomes an fd map: which descriptor each of fds
+ * 0 to 9 of the command refers to (see `build_fd_map`). Around an
+ * external command the map is applied as spawn file actions (see
+ * `spawn_redirected`), around a builtin it becomes its I/O context (see
+ * `redirect_builtin`), and around anything else it is applied to the
+ * shell's own streams for the duration of the command.
  *
- * @param redirect The redirection structure containing file and command 
- * information.
+ * @param node The REDIR node.
+ * @param op_status Whether the current process may be replaced.
  * @param shell Pointer to the shell structure for process management.
  * @return The exit code of the command or an error code.
  */
-int	process_redirection(t_redir *redirect, t_shell *shell)
+int	process_redirection(t_ast *node, t_op_status op_status, t_shell *shell)
 {
-	if (redirect->redir_type == T_INPUT || redirect->redir_type == T_HDOC)
-		return (process_input_redirection(redirect, shell));
-	return (process_output_redirection(redirect, shell));
+	t_stage	stage;
+	int		raw_status;
+
+	if (redirects_external(node, shell) && op_status == OP_TERMINATE)
+		return (exec_redirected(node, shell));
+	if (redirects_external(node, shell))
+	{
+		stage = spawn_redirected(node, NULL, shell);
+		if (stage.pid == 0)
+			return (stage.status);
+		wait_for_child(stage.pid, &raw_status, shell);
+		return (handle_exit_signal(raw_status, NULL, shell));
+	}
+	if (redirects_builtin(node, shell))
+		return (redirect_builtin(node, shell));
+	return (redirect_compound(node, shell));
 }
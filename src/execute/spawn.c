@@ -0,0 +1,177 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:59:26 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:59:26 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Prepares the attributes of a spawned program.
+ *
+ * The shell ignores SIGINT and SIGQUIT while it waits for commands, and an
+ * ignored signal stays ignored across `execve`. The spawned program gets
+ * the default action for both, and for SIGPIPE, with an empty signal mask.
+ * A program started by a background job keeps ignoring SIGINT and SIGQUIT.
+ *
+ * @param attr Attributes to initialize.
+ * @param is_async Whether the program belongs to a background job.
+ * @return 0 on success, or an error number.
+ */
+static int	init_spawn_attr(posix_spawnattr_t *attr, bool is_async)
+{
+	sigset_t	defaults;
+	sigset_t	mask;
+	int			err;
+
+	err = posix_spawnattr_init(attr);
+	if (err)
+		return (err);
+	sigemptyset(&mask);
+	sigemptyset(&defaults);
+	sigaddset(&defaults, SIGPIPE);
+	if (!is_async)
+	{
+		sigaddset(&defaults, SIGINT);
+		sigaddset(&defaults, SIGQUIT);
+	}
+	err = posix_spawnattr_setsigdefault(attr, &defaults);
+	if (!err)
+		err = posix_spawnattr_setsigmask(attr, &mask);
+	if (!err)
+		err = posix_spawnattr_setflags(attr,
+				POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK);
+	return (err);
+}
+
+/**
+ * @brief Records the fd operations of a stage as spawn file actions.
+ *
+ * A close is only needed for a descriptor the program would inherit; the
+ * shell's own descriptors are close-on-exec and disappear at `execve`
+ * anyway, as do the pipe ends and files the operations copy from.
+ *
+ * @param actions File actions to fill.
+ * @param steps Steps from `schedule_fd_map`.
+ * @param count Number of steps.
+ * @return 0 on success, or an error number.
+ */
+static int	add_stage_fds(posix_spawn_file_actions_t *actions,
+		t_fd_step *steps, int count)
+{
+	int	err;
+	int	i;
+
+	err = 0;
+	i = -1;
+	while (!err && ++i < count)
+	{
+		if (steps[i].src != FD_CLOSED)
+			err = posix_spawn_file_actions_adddup2(actions, steps[i].src,
+					steps[i].dst);
+		else if (!(fcntl(steps[i].dst, F_GETFD) & FD_CLOEXEC))
+			err = posix_spawn_file_actions_addclose(actions, steps[i].dst);
+	}
+	return (err);
+}
+
+/**
+ * @brief Builds the spawn file actions of a stage.
+ *
+ * A `dup2` action onto the descriptor it copies (`src == dst`) clears the
+ * close-on-exec flag of a file opened on its own number, and of the
+ * process substitutions the command names (see `add_proc_subst_fds`).
+ *
+ * @param actions Storage for the file actions.
+ * @param cmd The command.
+ * @param map Fd map of the stage, or NULL.
+ * @param shell Pointer to the shell structure.
+ * @return `actions`, or NULL when the stage inherits all streams.
+ */
+static posix_spawn_file_actions_t	*init_stage_actions(
+	posix_spawn_file_actions_t *actions, t_cmd *cmd, t_fd_map *map,
+	t_shell *shell)
+{
+	t_fd_step	steps[FD_MAP_SIZE];
+	int			count;
+	int			err;
+
+	count = 0;
+	if (map)
+		count = schedule_fd_map(map, steps, shell);
+	if (count == 0 && !shell->proc_substs)
+		return (NULL);
+	err = posix_spawn_file_actions_init(actions);
+	if (!err)
+		err = add_stage_fds(actions, steps, count);
+	if (!err)
+		err = add_proc_subst_fds(actions, cmd->cmd_args, shell);
+	if (err)
+		exit_on_sys_error("posix_spawn_file_actions", err, shell);
+	return (actions);
+}
+
+/**
+ * @brief Maps a launch error to the status and message of the command.
+ *
+ * @param cmd The command that could not be launched.
+ * @param err Error number returned by `posix_spawn`.
+ * @param shell Pointer to the shell structure.
+ * @return The stage: no process, status 127 for ENOENT and 126 otherwise.
+ */
+static t_stage	spawn_failed(t_cmd *cmd, int err, t_shell *shell)
+{
+	t_stage	stage;
+
+	stage.pid = 0;
+	stage.status = 126;
+	if (err == ENOENT)
+		stage.status = 127;
+	report_cmd_error(cmd->cmd_args[0], strerror(err), stage.status, shell);
+	return (stage);
+}
+
+/**
+ * @brief Launches an external program without duplicating the shell.
+ *
+ * The program is started with `posix_spawn`, which shares the address space
+ * of the shell until the `execve` instead of copying its page tables, so the
+ * cost of a launch does not grow with the shell heap. The executable must
+ * already be resolved (`cmd->exec_path`), and the environment comes from
+ * the cached envp. The program is handed to the supervisor. Only shell
+ * code still needs `create_process`.
+ *
+ * @param cmd The resolved command.
+ * @param map Fd map of the stage, or NULL to inherit all streams.
+ * @param shell Pointer to the shell structure.
+ * @return The stage: PID of the program, or 0 with the failure status.
+ */
+t_stage	spawn_program(t_cmd *cmd, t_fd_map *map, t_shell *shell)
+{
+	posix_spawnattr_t			attr;
+	posix_spawn_file_actions_t	actions;
+	posix_spawn_file_actions_t	*actions_ptr;
+	t_stage						stage;
+	int							err;
+
+	err = init_spawn_attr(&attr, shell->is_async);
+	if (err)
+		exit_on_sys_error("posix_spawnattr", err, shell);
+	actions_ptr = init_stage_actions(&actions, cmd, map, shell);
+	err = posix_spawn(&stage.pid, cmd->exec_path, actions_ptr, &attr,
+			cmd->cmd_args, get_ev_array(shell));
+	posix_spawnattr_destroy(&attr);
+	if (actions_ptr)
+		posix_spawn_file_actions_destroy(actions_ptr);
+	if (err)
+		return (spawn_failed(cmd, err, shell));
+	supervise_child(stage.pid, shell);
+	stage.status = EXIT_SUCCESS;
+	return (stage);
+}
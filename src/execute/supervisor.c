@@ -0,0 +1,159 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   supervisor.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:09:26 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:09:26 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Collects the exit status and resource usage of a child.
+ *
+ * This is the only place where the shell reaps a process. A reaped child
+ * bumps the shell's filesystem epoch, as it may have created files in PATH
+ * directories, its resource usage is added to the totals read by `time`,
+ * and its pidfd is closed (which also removes it from the
+ * epoll set).
+ *
+ * @param child Record of the child.
+ * @param flags 0 to block until the child exits, or WNOHANG.
+ * @param shell Pointer to the shell structure.
+ */
+static void	reap_child(t_child *child, int flags, t_shell *shell)
+{
+	pid_t	ret;
+
+	ret = wait4(child->pid, &child->status, flags, &child->usage);
+	while (ret == -1 && errno == EINTR)
+		ret = wait4(child->pid, &child->status, flags, &child->usage);
+	if (ret == -1)
+		exit_on_sys_error("wait4 failed", errno, shell);
+	if (ret == 0)
+		return ;
+	child->done = true;
+	shell->fs_epoch++;
+	account_usage(&child->usage, shell);
+	if (child->pidfd != -1)
+		close(child->pidfd);
+	child->pidfd = -1;
+}
+
+/**
+ * @brief Opens a pidfd for a child and adds it to the epoll set.
+ *
+ * Pidfds only use the lower half of the descriptor table (`fd_budget`), so
+ * a long pipeline cannot starve the pipes it still has to create.
+ *
+ * @param pid PID of the child.
+ * @param shell Pointer to the shell structure.
+ * @return The registered pidfd, or -1 if none could be used.
+ */
+static int	open_pidfd(pid_t pid, t_shell *shell)
+{
+	struct epoll_event	event;
+	int					pidfd;
+
+	if (shell->sup.epfd == -1)
+		init_supervisor(shell);
+	if (shell->sup.epfd == -1)
+		return (-1);
+	pidfd = raise_fd(syscall(SYS_pidfd_open, pid, 0));
+	if (pidfd == -1)
+		return (-1);
+	ft_bzero(&event, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.u64 = (uint64_t)pid;
+	if (pidfd >= shell->sup.fd_budget
+		|| epoll_ctl(shell->sup.epfd, EPOLL_CTL_ADD, pidfd, &event) == -1)
+	{
+		close(pidfd);
+		return (-1);
+	}
+	return (pidfd);
+}
+
+/**
+ * @brief Starts supervising a child created by the shell.
+ *
+ * The child gets a record and, when possible, a pidfd registered in the
+ * supervisor's epoll set, so its exit can be noticed without blocking in
+ * `wait`. Without a pidfd (old kernel, descriptor budget exhausted) the
+ * child is still tracked and is reaped with a blocking `wait4` when it is
+ * awaited.
+ *
+ * @param pid PID of the new child.
+ * @param shell Pointer to the shell structure.
+ */
+void	supervise_child(pid_t pid, t_shell *shell)
+{
+	t_child	*child;
+
+	child = add_child(pid, shell);
+	child->pidfd = open_pidfd(pid, shell);
+}
+
+/**
+ * @brief Reaps the supervised children that have exited.
+ *
+ * @param timeout_ms Maximum time to wait for an exit, in milliseconds:
+ * 0 returns immediately and -1 waits until a child exits.
+ * @param shell Pointer to the shell structure.
+ * @return The number of children that became ready.
+ */
+int	supervisor_poll(int timeout_ms, t_shell *shell)
+{
+	struct epoll_event	events[SUP_EVENTS];
+	t_child				*child;
+	int					ready;
+	int					i;
+
+	if (shell->sup.epfd == -1)
+		return (0);
+	ready = epoll_wait(shell->sup.epfd, events, SUP_EVENTS, timeout_ms);
+	if (ready == -1 && errno != EINTR)
+		exit_on_sys_error("epoll_wait failed", errno, shell);
+	i = 0;
+	while (i < ready)
+	{
+		child = find_child((pid_t)events[i++].data.u64, shell);
+		if (child && !child->done)
+			reap_child(child, WNOHANG, shell);
+	}
+	return (ft_max(ready, 0));
+}
+
+/**
+ * @brief Waits until a supervised child has exited and forgets it.
+ *
+ * Other children that exit in the meantime are reaped too; their records
+ * keep their status until they are awaited.
+ *
+ * @param pid PID of the child.
+ * @param shell Pointer to the shell structure.
+ * @return A copy of the child's final record (status and resource usage).
+ */
+t_child	await_child(pid_t pid, t_shell *shell)
+{
+	t_child	*child;
+	t_child	result;
+
+	child = find_child(pid, shell);
+	if (!child)
+		exit_on_sys_error("wait", ECHILD, shell);
+	while (!child->done)
+	{
+		if (child->pidfd == -1)
+			reap_child(child, 0, shell);
+		else
+			supervisor_poll(-1, shell);
+	}
+	result = *child;
+	release_child(pid, shell);
+	return (result);
+}
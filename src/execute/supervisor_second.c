@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   supervisor_second.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:09:26 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:09:26 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Adds a record for a new child to the supervisor.
+ *
+ * The record table grows geometrically and is not tracked per command:
+ * children may outlive the command that created them.
+ *
+ * @param pid PID of the child.
+ * @param shell Pointer to the shell structure.
+ * @return The new record, with no pidfd.
+ */
+t_child	*add_child(pid_t pid, t_shell *shell)
+{
+	t_supervisor	*sup;
+	t_child			*grown;
+
+	sup = &shell->sup;
+	if (sup->count == sup->cap)
+	{
+		grown = calloc_tracked(ft_max(sup->cap * 2, 8), sizeof(t_child),
+				UNTRACKED, shell);
+		if (sup->count > 0)
+			ft_memcpy(grown, sup->children, sup->count * sizeof(t_child));
+		free(sup->children);
+		sup->children = grown;
+		sup->cap = ft_max(sup->cap * 2, 8);
+	}
+	ft_bzero(&sup->children[sup->count], sizeof(t_child));
+	sup->children[sup->count].pid = pid;
+	sup->children[sup->count].pidfd = -1;
+	return (&sup->children[sup->count++]);
+}
+
+/**
+ * @brief Finds the record of a supervised child.
+ *
+ * @param pid PID of the child.
+ * @param shell Pointer to the shell structure.
+ * @return The record, or NULL if the child is not supervised.
+ */
+t_child	*find_child(pid_t pid, t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (i < shell->sup.count)
+	{
+		if (shell->sup.children[i].pid == pid)
+			return (&shell->sup.children[i]);
+		i++;
+	}
+	return (NULL);
+}
+
+/**
+ * @brief Removes the record of a child.
+ *
+ * The last record takes the freed slot, so record pointers are only valid
+ * until the next call to `release_child` or `add_child`.
+ *
+ * @param pid PID of the child.
+ * @param shell Pointer to the shell structure.
+ */
+void	release_child(pid_t pid, t_shell *shell)
+{
+	t_child	*child;
+
+	child = find_child(pid, shell);
+	if (!child)
+		return ;
+	if (child->pidfd != -1)
+		close(child->pidfd);
+	*child = shell->sup.children[--shell->sup.count];
+}
+
+/**
+ * @brief Drops every record and closes the supervisor's descriptors.
+ *
+ * Called on exit, and in a forked child: the children of the shell are
+ * not children of the new process, which starts with an empty supervisor.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	supervisor_reset(t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (i < shell->sup.count)
+	{
+		if (shell->sup.children[i].pidfd != -1)
+			close(shell->sup.children[i].pidfd);
+		i++;
+	}
+	if (shell->sup.epfd != -1)
+		close(shell->sup.epfd);
+	free(shell->sup.children);
+	ft_bzero(&shell->sup, sizeof(t_supervisor));
+	shell->sup.epfd = -1;
+}
+
+/**
+ * @brief Creates the epoll set and computes the pidfd budget.
+ *
+ * The budget is half of the soft limit on open descriptors.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	init_supervisor(t_shell *shell)
+{
+	struct rlimit	limit;
+
+	shell->sup.epfd = raise_fd(epoll_create1(EPOLL_CLOEXEC));
+	shell->sup.fd_budget = INT_MAX;
+	if (getrlimit(RLIMIT_NOFILE, &limit) == 0
+		&& limit.rlim_cur != RLIM_INFINITY && limit.rlim_cur / 2 < INT_MAX)
+		shell->sup.fd_budget = (int)(limit.rlim_cur / 2);
+}
@@ -0,0 +1,128 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:20:02 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:20:02 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Adds the resource usage of a reaped child to the shell's totals.
+ *
+ * CPU times and event counts are summed; the peak RSS is the largest one
+ * seen. `time` reads these totals before and after its command.
+ *
+ * @param usage Resource usage returned by `wait4`.
+ * @param shell Pointer to the shell structure.
+ */
+void	account_usage(struct rusage *usage, t_shell *shell)
+{
+	struct rusage	*total;
+
+	total = &shell->child_usage;
+	timeradd(&total->ru_utime, &usage->ru_utime, &total->ru_utime);
+	timeradd(&total->ru_stime, &usage->ru_stime, &total->ru_stime);
+	if (usage->ru_maxrss > total->ru_maxrss)
+		total->ru_maxrss = usage->ru_maxrss;
+	total->ru_minflt += usage->ru_minflt;
+	total->ru_majflt += usage->ru_majflt;
+	total->ru_nvcsw += usage->ru_nvcsw;
+	total->ru_nivcsw += usage->ru_nivcsw;
+}
+
+/**
+ * @brief Records the clock and the resource usage at one point in time.
+ *
+ * @param sample Sample to fill.
+ * @param shell Pointer to the shell structure.
+ */
+static void	take_sample(t_time_sample *sample, t_shell *shell)
+{
+	clock_gettime(CLOCK_MONOTONIC, &sample->wall);
+	getrusage(RUSAGE_SELF, &sample->self);
+	sample->children = shell->child_usage;
+}
+
+/**
+ * @brief Converts a `timeval` to microseconds.
+ *
+ * @param tv Time to convert.
+ * @return The time in microseconds.
+ */
+static long long	tv_usec(struct timeval *tv)
+{
+	return ((long long)tv->tv_sec * 1000000 + tv->tv_usec);
+}
+
+/**
+ * @brief Computes what happened between two samples.
+ *
+ * CPU times include the shell itself, which runs builtins and launches
+ * the processes, and every child reaped in between. Event counts come
+ * from the children only.
+ *
+ * @param start Sample taken before the command.
+ * @param end Sample taken after the command.
+ * @param r Report to fill (`status` and the counters are left untouched).
+ */
+static void	build_report(t_time_sample *start, t_time_sample *end,
+		t_time_report *r)
+{
+	r->real_us = (long long)(end->wall.tv_sec - start->wall.tv_sec) * 1000000
+		+ (end->wall.tv_nsec - start->wall.tv_nsec) / 1000;
+	r->user_us = tv_usec(&end->self.ru_utime) - tv_usec(&start->self.ru_utime)
+		+ tv_usec(&end->children.ru_utime)
+		- tv_usec(&start->children.ru_utime);
+	r->sys_us = tv_usec(&end->self.ru_stime) - tv_usec(&start->self.ru_stime)
+		+ tv_usec(&end->children.ru_stime)
+		- tv_usec(&start->children.ru_stime);
+	r->maxrss = end->children.ru_maxrss;
+	r->minflt = end->children.ru_minflt - start->children.ru_minflt;
+	r->majflt = end->children.ru_majflt - start->children.ru_majflt;
+	r->nvcsw = end->children.ru_nvcsw - start->children.ru_nvcsw;
+	r->nivcsw = end->children.ru_nivcsw - start->children.ru_nivcsw;
+}
+
+/**
+ * @brief Runs a command under the `time` keyword and reports its cost.
+ *
+ * The peak RSS is tracked from zero while the command runs, so the report
+ * shows the largest child of this command only; the shell-wide peak is
+ * restored afterwards. With `-v`, perf counters inherited by the children
+ * are open while the command runs. The report goes to the shell's stderr,
+ * outside of the command's own redirections.
+ *
+ * @param timed The TIME node.
+ * @param shell Pointer to the shell structure.
+ * @return The exit status of the timed command.
+ */
+int	process_timed(t_timed *timed, t_shell *shell)
+{
+	t_time_sample	start;
+	t_time_sample	end;
+	t_time_report	report;
+	long			outer_maxrss;
+	int				counter_fds[CTR_COUNT];
+
+	outer_maxrss = shell->child_usage.ru_maxrss;
+	shell->child_usage.ru_maxrss = 0;
+	report.verbose = (timed->flags & TIME_VERBOSE) != 0;
+	if (report.verbose)
+		perf_start(counter_fds);
+	take_sample(&start, shell);
+	report.status = run_cmd(timed->command, OP_COMPLETE, shell);
+	take_sample(&end, shell);
+	if (report.verbose)
+		perf_stop(counter_fds, report.counters);
+	build_report(&start, &end, &report);
+	if (shell->child_usage.ru_maxrss < outer_maxrss)
+		shell->child_usage.ru_maxrss = outer_maxrss;
+	print_time_report(&report, timed->flags, shell);
+	return (report.status);
+}
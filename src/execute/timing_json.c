@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing_json.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:22:00 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:22:00 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends the counters of `time -v` as JSON members.
+ *
+ * An unsupported counter is `null`.
+ *
+ * @param r The report.
+ * @param buf Output buffer.
+ * @param shell Pointer to the shell structure.
+ */
+static void	append_counters_json(t_time_report *r, t_outbuf *buf,
+		t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (i < CTR_COUNT)
+	{
+		outbuf_append(buf, ",\"", shell);
+		outbuf_append(buf, counter_name(i, true), shell);
+		outbuf_append(buf, "\":", shell);
+		if (r->counters[i] == -1)
+			outbuf_append(buf, "null", shell);
+		else if (i == CTR_TASK_CLOCK)
+			outbuf_append_fixed(buf, r->counters[i], 3, shell);
+		else
+			outbuf_append_num(buf, r->counters[i], 1, shell);
+		i++;
+	}
+}
+
+/**
+ * @brief Appends the report as a single-line JSON object.
+ *
+ * Times are in seconds, the peak RSS in kilobytes.
+ *
+ * @param r The report.
+ * @param buf Output buffer.
+ * @param shell Pointer to the shell structure.
+ */
+void	report_json(t_time_report *r, t_outbuf *buf, t_shell *shell)
+{
+	outbuf_append(buf, "{\"real\":", shell);
+	outbuf_append_fixed(buf, r->real_us, 6, shell);
+	outbuf_append(buf, ",\"user\":", shell);
+	outbuf_append_fixed(buf, r->user_us, 6, shell);
+	outbuf_append(buf, ",\"sys\":", shell);
+	outbuf_append_fixed(buf, r->sys_us, 6, shell);
+	outbuf_append(buf, ",\"maxrss_kb\":", shell);
+	outbuf_append_num(buf, r->maxrss, 1, shell);
+	outbuf_append(buf, ",\"minflt\":", shell);
+	outbuf_append_num(buf, r->minflt, 1, shell);
+	outbuf_append(buf, ",\"majflt\":", shell);
+	outbuf_append_num(buf, r->majflt, 1, shell);
+	outbuf_append(buf, ",\"nvcsw\":", shell);
+	outbuf_append_num(buf, r->nvcsw, 1, shell);
+	outbuf_append(buf, ",\"nivcsw\":", shell);
+	outbuf_append_num(buf, r->nivcsw, 1, shell);
+	outbuf_append(buf, ",\"status\":", shell);
+	outbuf_append_num(buf, r->status, 1, shell);
+	if (r->verbose)
+		append_counters_json(r, buf, shell);
+	outbuf_append(buf, "}\n", shell);
+}
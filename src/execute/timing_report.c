@@ -0,0 +1,136 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   timing_report.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:20:02 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:20:02 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends a line of the default report, such as `real\t0m1.002s`.
+ *
+ * @param buf Output buffer.
+ * @param label Name of the measure.
+ * @param us Duration in microseconds.
+ * @param shell Pointer to the shell structure.
+ */
+static void	append_clock(t_outbuf *buf, char *label, long long us,
+		t_shell *shell)
+{
+	outbuf_append(buf, label, shell);
+	outbuf_add(buf, "\t", 1, shell);
+	outbuf_append_num(buf, us / 60000000, 1, shell);
+	outbuf_add(buf, "m", 1, shell);
+	outbuf_append_fixed(buf, us % 60000000, 3, shell);
+	outbuf_add(buf, "s\n", 2, shell);
+}
+
+/**
+ * @brief Appends a line of the POSIX report, such as `real 1.00`.
+ *
+ * @param buf Output buffer.
+ * @param label Name of the measure.
+ * @param us Duration in microseconds.
+ * @param shell Pointer to the shell structure.
+ */
+static void	append_posix(t_outbuf *buf, char *label, long long us,
+		t_shell *shell)
+{
+	outbuf_append(buf, label, shell);
+	outbuf_add(buf, " ", 1, shell);
+	outbuf_append_fixed(buf, us, 2, shell);
+	outbuf_add(buf, "\n", 1, shell);
+}
+
+/**
+ * @brief Appends the counters of `time -v`, one per line.
+ *
+ * @param r The report.
+ * @param buf Output buffer.
+ * @param shell Pointer to the shell structure.
+ */
+static void	append_counters(t_time_report *r, t_outbuf *buf, t_shell *shell)
+{
+	int	i;
+
+	i = 0;
+	while (i < CTR_COUNT)
+	{
+		outbuf_append(buf, counter_name(i, false), shell);
+		outbuf_add(buf, "\t", 1, shell);
+		if (r->counters[i] == -1)
+			outbuf_append(buf, "<not supported>", shell);
+		else if (i == CTR_TASK_CLOCK)
+		{
+			outbuf_append_fixed(buf, r->counters[i], 3, shell);
+			outbuf_append(buf, " msec", shell);
+		}
+		else
+			outbuf_append_num(buf, r->counters[i], 1, shell);
+		outbuf_add(buf, "\n", 1, shell);
+		i++;
+	}
+}
+
+/**
+ * @brief Appends the report in one of the text formats.
+ *
+ * The default format follows bash (`real\t0m0.000s`) and adds the peak
+ * RSS of the children; `-p` prints the three POSIX lines. With `-v`, the
+ * counters follow.
+ *
+ * @param r The report.
+ * @param flags Output format flags of the TIME node.
+ * @param buf Output buffer.
+ * @param shell Pointer to the shell structure.
+ */
+static void	report_text(t_time_report *r, int flags, t_outbuf *buf,
+		t_shell *shell)
+{
+	if (flags & TIME_POSIX)
+	{
+		append_posix(buf, "real", r->real_us, shell);
+		append_posix(buf, "user", r->user_us, shell);
+		append_posix(buf, "sys", r->sys_us, shell);
+	}
+	else
+	{
+		outbuf_add(buf, "\n", 1, shell);
+		append_clock(buf, "real", r->real_us, shell);
+		append_clock(buf, "user", r->user_us, shell);
+		append_clock(buf, "sys", r->sys_us, shell);
+		outbuf_append(buf, "maxrss\t", shell);
+		outbuf_append_num(buf, r->maxrss, 1, shell);
+		outbuf_add(buf, "k\n", 2, shell);
+	}
+	if (r->verbose)
+		append_counters(r, buf, shell);
+}
+
+/**
+ * @brief Prints the report of `time` to stderr.
+ *
+ * `-j` prints one JSON object per command, for tools that collect the
+ * measures; otherwise a text format is used.
+ *
+ * @param r The report.
+ * @param flags Output format flags of the TIME node.
+ * @param shell Pointer to the shell structure.
+ */
+void	print_time_report(t_time_report *r, int flags, t_shell *shell)
+{
+	t_outbuf	buf;
+
+	ft_bzero(&buf, sizeof(buf));
+	if (flags & TIME_JSON)
+		report_json(r, &buf, shell);
+	else
+		report_text(r, flags, &buf, shell);
+	outbuf_flush(&buf, STDERR_FILENO, shell);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:35:05 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:35:05 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Removes the quotes of a heredoc delimiter.
+ *
+ * @param raw The delimiter as written.
+ * @param shell Pointer to the shell structure.
+ * @return The delimiter the body ends with.
+ */
+static char	*heredoc_delimiter(char *raw, t_shell *shell)
+{
+	char	*delim;
+	char	quote;
+	int		i;
+	int		j;
+
+	delim = calloc_tracked(ft_strlen(raw) + 1, sizeof(char), COMMAND_TRACK,
+			shell);
+	quote = '\0';
+	i = -1;
+	j = 0;
+	while (raw[++i])
+	{
+		if (!quote && (raw[i] == '\'' || raw[i] == '\"'))
+			quote = raw[i];
+		else if (quote && raw[i] == quote)
+			quote = '\0';
+		else
+		{
+			if (raw[i] == '\\' && quote != '\'' && raw[i + 1])
+				i++;
+			delim[j++] = raw[i];
+		}
+	}
+	return (delim);
+}
+
+/**
+ * @brief Reads the lines of a heredoc body up to its delimiter.
+ *
+ * @param delim The delimiter.
+ * @param body Buffer receiving the lines, each ended by a newline.
+ * @param shell Pointer to the shell structure.
+ * @return EXIT_SUCCESS, or EXIT_FAILURE if the input ended first.
+ */
+static int	read_heredoc_body(char *delim, t_outbuf *body, t_shell *shell)
+{
+	char	*line;
+
+	line = get_input(IN_HDOC);
+	while (line && g_signal != SIGINT && ft_strcmp(line, delim))
+	{
+		outbuf_append(body, line, shell);
+		outbuf_add(body, "\n", 1, shell);
+		free(line);
+		line = get_input(IN_HDOC);
+	}
+	if (g_signal == SIGINT)
+		shell->hdoc_interrupted = true;
+	if (!line)
+		return (EXIT_FAILURE);
+	free(line);
+	return (EXIT_SUCCESS);
+}
+
+/**
+ * @brief Reads the body of a heredoc while its command line is parsed.
+ *
+ * The body is kept in the redirection node; it is expanded (unless the
+ * delimiter is quoted) and handed to the command when the redirection is
+ * applied. Bodies are read in the order the heredocs appear on the line.
+ *
+ * @param redir Redirection node of the heredoc; `filename` holds the
+ * delimiter.
+ * @param shell Pointer to the shell structure.
+ * @return false if the heredoc was interrupted by SIGINT (the command line
+ * is then dropped), true otherwise.
+ */
+bool	collect_heredoc(t_redir *redir, t_shell *shell)
+{
+	t_outbuf	body;
+	char		*delim;
+	bool		quoted;
+
+	if (shell->hdoc_interrupted)
+		return (false);
+	delim = heredoc_delimiter(redir->filename, shell);
+	quoted = (ft_strchr(redir->filename, '\'') || ft_strchr(redir->filename,
+				'\"') || ft_strchr(redir->filename, '\\'));
+	ft_bzero(&body, sizeof(t_outbuf));
+	outbuf_add(&body, "", 0, shell);
+	if (read_heredoc_body(delim, &body, shell) != EXIT_SUCCESS
+		&& !shell->hdoc_interrupted)
+		error_msg("warning: here-document delimited by end-of-file "
+			"(wanted `", delim, "')", shell);
+	redir->body = body.data;
+	redir->body_len = body.len;
+	redir->expand_body = !quoted;
+	return (!shell->hdoc_interrupted);
+}
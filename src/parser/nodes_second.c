@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   nodes_second.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:12:01 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:12:01 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Creates an AST node for a command run in the background.
+ *
+ * @param command AST node of the command followed by `&`.
+ * @param next AST node of the rest of the list, or NULL.
+ * @param text Source text of the command, used to describe the job.
+ * @param shell Pointer to the shell structure for memory management.
+ * @return Pointer to the created AST node.
+ */
+t_ast	*build_node_bg(t_ast *command, t_ast *next, char *text,
+		t_shell *shell)
+{
+	t_ast	*bg_node;
+
+	bg_node = calloc_tracked(1, sizeof(t_ast), COMMAND_TRACK, shell);
+	bg_node->node_type = BG;
+	bg_node->u_node_cont.bg.command = command;
+	bg_node->u_node_cont.bg.next = next;
+	bg_node->u_node_cont.bg.text = text;
+	return (bg_node);
+}
+
+/**
+ * @brief Creates an AST node for a command run under `time`.
+ *
+ * @param command AST node of the timed command, or NULL.
+ * @param flags Options of the report (`TIME_POSIX`, `TIME_JSON`,
+ * `TIME_VERBOSE`).
+ * @param shell Pointer to the shell structure for memory management.
+ * @return Pointer to the created AST node.
+ */
+t_ast	*build_node_timed(t_ast *command, int flags, t_shell *shell)
+{
+	t_ast	*timed_node;
+
+	timed_node = calloc_tracked(1, sizeof(t_ast), COMMAND_TRACK, shell);
+	timed_node->node_type = TIME;
+	timed_node->u_node_cont.timed.command = command;
+	timed_node->u_node_cont.timed.flags = flags;
+	return (timed_node);
+}
@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_time.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:19:08 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:19:08 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Applies an option of the `time` keyword.
+ *
+ * @param word Word following `time`.
+ * @param flags Output format flags to update.
+ * @return true if `word` is an option of `time`.
+ */
+static bool	parse_time_option(char *word, int *flags)
+{
+	if (!ft_strcmp(word, "-p"))
+		*flags |= TIME_POSIX;
+	else if (!ft_strcmp(word, "-j"))
+		*flags |= TIME_JSON;
+	else if (!ft_strcmp(word, "-v"))
+		*flags |= TIME_VERBOSE;
+	else
+		return (false);
+	return (true);
+}
+
+/**
+ * @brief Parses an operand of a logical list, with an optional `time`.
+ *
+ * An unquoted `time` at the start of an operand is a keyword: it times the
+ * pipeline that follows, up to the next `&&`, `||`, `&` or `)`, as in
+ * bash; a subshell times a whole list. `-p` selects
+ * the POSIX format, `-j` a JSON object and `-v` adds perf counters; `--`
+ * ends the options.
+ *
+ * @param tkn_list Pointer to the list of tokens.
+ * @param shell Pointer to the shell structure.
+ * @return Pointer to the AST of the operand.
+ */
+t_ast	*parse_timed(t_list **tkn_list, t_shell *shell)
+{
+	int	flags;
+
+	if (!*tkn_list || get_type(*tkn_list) != T_TEXT
+		|| ft_strcmp(get_value(*tkn_list), "time"))
+		return (parse_pipe(tkn_list, shell));
+	*tkn_list = (*tkn_list)->next;
+	flags = 0;
+	while (*tkn_list && get_type(*tkn_list) == T_TEXT
+		&& parse_time_option(get_value(*tkn_list), &flags))
+		*tkn_list = (*tkn_list)->next;
+	if (*tkn_list && get_type(*tkn_list) == T_TEXT
+		&& !ft_strcmp(get_value(*tkn_list), "--"))
+		*tkn_list = (*tkn_list)->next;
+	return (build_node_timed(parse_pipe(tkn_list, shell), flags, shell));
+}
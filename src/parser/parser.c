@@ -66,12 +66,67 @@ t_ast	*parse_pipe(t_list **tkn_list, t_shell *shell)
 	return (input_side);
 }
 
+/**
+ * @brief Rebuilds the source text of a command from its tokens.
+ *
+ * Used to describe background jobs in `jobs` and completion notices.
+ *
+ * @param start First token of the command.
+ * @param end Token following the command.
+ * @param shell Pointer to the shell structure for memory management.
+ * @return The token values separated by single spaces.
+ */
+static char	*join_tokens(t_list *start, t_list *end, t_shell *shell)
+{
+	t_outbuf	text;
+
+	ft_bzero(&text, sizeof(t_outbuf));
+	while (start && start != end)
+	{
+		if (text.len > 0)
+			outbuf_add(&text, " ", 1, shell);
+		outbuf_append(&text, get_value(start), shell);
+		start = start->next;
+	}
+	return (text.data);
+}
+
+/**
+ * @brief Parses a list of commands separated by `&`.
+ *
+ * A command followed by `&` becomes a BG node: it runs in the background
+ * and the rest of the list (which may be empty) runs right away.
+ *
+ * @param tkn_list Pointer to the list of tokens representing the command.
+ * @param shell Pointer to the shell structure containing shell state 
+ * information.
+ * @return Pointer to the root of the AST representing the list.
+ */
+t_ast	*parse_list(t_list **tkn_list, t_shell *shell)
+{
+	t_list	*start;
+	t_ast	*command;
+	t_ast	*next;
+	char	*text;
+
+	start = *tkn_list;
+	command = parse_logic(tkn_list, shell);
+	if (!command || !*tkn_list || get_type(*tkn_list) != T_BG)
+		return (command);
+	text = join_tokens(start, *tkn_list, shell);
+	*tkn_list = (*tkn_list)->next;
+	next = NULL;
+	if (*tkn_list && get_type(*tkn_list) != T_BRACE_END)
+		next = parse_list(tkn_list, shell);
+	return (build_node_bg(command, next, text, shell));
+}
+
 /**
  * @brief Parses tokens enclosed in braces and creates corresponding AST nodes.
  *
  * This function handles tokens enclosed in braces (T_BRACE_START and 
  * T_BRACE_END).
- * It checks for the presence of an opening brace, then calls `parse_logic` 
+ * It checks for the presence of an opening brace, then calls `parse_list` 
  * to parse
  * the contents of the braces. Afterward, it checks for the presence of a 
  * closing brace.
@@ -93,7 +148,7 @@ t_ast	*parse_brace(t_list **tokens, t_shell *shell)
 	if (cur_tkn && get_type(cur_tkn) == T_BRACE_START)
 	{
 		cur_tkn = cur_tkn->next;
-		inner_expr = parse_logic(&cur_tkn, shell);
+		inner_expr = parse_list(&cur_tkn, shell);
 		if (!cur_tkn)
 			return (record_synt_err("\\n", shell));
 		if (get_type(cur_tkn) == T_BRACE_END)
@@ -117,13 +172,15 @@ t_ast	*parse_brace(t_list **tokens, t_shell *shell)
  * The function `parse_tokens` takes a list of tokens `tokens` and a `shell` 
  * structure.
  * It performs the following steps:
- * 1. Calls `parse_logic` to create an AST from the tokens.
- * 2. If there are leftover tokens after parsing, records a syntax error 
+ * 1. Calls `parse_list` to create an AST from the tokens.
+ * 2. If a heredoc was interrupted by SIGINT, drops the line and returns
+ *    130 without reporting a syntax error.
+ * 3. If there are leftover tokens after parsing, records a syntax error 
  * with the first
  *    unused token.
- * 3. If a syntax error is detected during parsing, displays it and returns 
+ * 4. If a syntax error is detected during parsing, displays it and returns 
  * the error result.
- * 4. If no errors are found, returns `EXIT_SUCCESS`.
+ * 5. If no errors are found, returns `EXIT_SUCCESS`.
  *
  * @param tokens Pointer to the list of tokens.
  * @param syntax_tree Pointer to a pointer for the syntax tree.
@@ -135,7 +192,12 @@ int	parse_tokens(t_list *tokens, t_ast **syntax_tree, t_shell *shell)
 	char	*invalid_token;
 	int		parse_result;
 
-	*syntax_tree = parse_logic(&tokens, shell);
+	*syntax_tree = parse_list(&tokens, shell);
+	if (shell->hdoc_interrupted)
+	{
+		shell->syntax_error = NULL;
+		return (130);
+	}
 	if (tokens)
 	{
 		invalid_token = get_value(tokens);
@@ -26,30 +26,21 @@
  */
 char	*get_tkn_label(t_tkn_type tkn_type)
 {
-	char	*result;
-
-	result = "unsupported token";
 	if (tkn_type == T_TEXT)
-		result = "text";
-	else if (tkn_type == T_HDOC)
-		result = "<<";
-	else if (tkn_type == T_APPEND)
-		result = ">>";
-	else if (tkn_type == T_PIPE)
-		result = "|";
-	else if (tkn_type == T_OR)
-		result = "||";
-	else if (tkn_type == T_BRACE_START)
-		result = "(";
-	else if (tkn_type == T_BRACE_END)
-		result = ")";
-	else if (tkn_type == T_AND)
-		result = "&&";
-	else if (tkn_type == T_INPUT)
-		result = "<";
-	else if (tkn_type == T_OUTPUT)
-		result = ">";
-	return (result);
+		return ("text");
+	if (redir_label(tkn_type))
+		return (redir_label(tkn_type));
+	if (tkn_type == T_PIPE)
+		return ("|");
+	if (tkn_type == T_OR)
+		return ("||");
+	if (tkn_type == T_BRACE_START)
+		return ("(");
+	if (tkn_type == T_BRACE_END)
+		return (")");
+	if (tkn_type == T_AND)
+		return ("&&");
+	return ("unsupported token");
 }
 
 /**
@@ -165,7 +156,7 @@ t_ast	*parse_cmd(t_list **tokens, t_shell *shell)
  * @return Pointer to the root of the AST representing the logical expression.
  *
  * The function performs the following steps:
- * 1. Parses the first subexpression using `parse_pipe` and saves it as 
+ * 1. Parses the first subexpression using `parse_timed` and saves it as 
  * `first_expr`.
  * 2. In a loop, checks if there are more tokens to parse and if they are 
  * logical
@@ -173,7 +164,7 @@ t_ast	*parse_cmd(t_list **tokens, t_shell *shell)
  * 3. If the current token is a logical operator, saves its type in 
  * `operator_type`
  *    and moves to the next token.
- * 4. Parses the second subexpression using `parse_pipe` and saves it 
+ * 4. Parses the second subexpression using `parse_timed` and saves it 
  * as `second_expr`.
  * 5. If the second subexpression fails to parse, returns the first 
  * subexpression.
@@ -191,14 +182,14 @@ t_ast	*parse_logic(t_list **tkn_list, t_shell *shell)
 	t_ast		*logical_expr;
 	t_tkn_type	operator_type;
 
-	first_expr = parse_pipe(tkn_list, shell);
+	first_expr = parse_timed(tkn_list, shell);
 	while (tkn_list && *tkn_list)
 	{
 		operator_type = get_type(*tkn_list);
 		if (operator_type != T_AND && operator_type != T_OR)
 			break ;
 		*tkn_list = (*tkn_list)->next;
-		second_expr = parse_pipe(tkn_list, shell);
+		second_expr = parse_timed(tkn_list, shell);
 		if (!second_expr)
 			return (first_expr);
 		logical_expr = build_node_logic(first_expr, operator_type, second_expr,
@@ -12,6 +12,37 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Returns the operator of a redirection type.
+ *
+ * @param type The type of a token.
+ * @return The operator, or NULL if `type` is not a redirection.
+ */
+char	*redir_label(t_tkn_type type)
+{
+	if (type == T_INPUT)
+		return ("<");
+	if (type == T_OUTPUT)
+		return (">");
+	if (type == T_APPEND)
+		return (">>");
+	if (type == T_HDOC)
+		return ("<<");
+	if (type == T_HSTR)
+		return ("<<<");
+	if (type == T_RDWR)
+		return ("<>");
+	if (type == T_DUP_IN)
+		return ("<&");
+	if (type == T_DUP_OUT)
+		return (">&");
+	if (type == T_OUT_ALL)
+		return ("&>");
+	if (type == T_APPEND_ALL)
+		return ("&>>");
+	return (NULL);
+}
+
 /**
  * @brief Checks if the current token is a valid redirection or text that
  *  is followed by a command.
@@ -23,8 +54,8 @@
  * 2. Gets the type of the current token.
  * 3. If the token type is `T_TEXT` and a command node `cmd_node` is present,
  *  returns `true`.
- * 4. If the token type is `T_APPEND`, `T_HDOC`, `T_INPUT`, or `T_OUTPUT`, 
- * returns `true`.
+ * 4. If the token is a redirection operator (see `redir_label`), returns
+ * `true`.
  * 5. In all other cases, returns `false`.
  *
  * @param tokens Pointer to the list of tokens.
@@ -40,10 +71,29 @@ bool	is_valid_redir(t_list **tokens, t_ast *cmd_node)
 	type = get_type(*tokens);
 	if (cmd_node && type == T_TEXT)
 		return (true);
-	if (type == T_APPEND || type == T_HDOC || type == T_INPUT
-		|| type == T_OUTPUT)
-		return (true);
-	return (false);
+	return (redir_label(type) != NULL);
+}
+
+/**
+ * @brief Returns the descriptor a redirection operator applies to.
+ *
+ * @param token The operator token; a leading digit names the descriptor.
+ * @return The descriptor: the digit, or stdin for the input operators and
+ * stdout for the others.
+ */
+static int	redir_fd(t_list *token)
+{
+	char		*value;
+	t_tkn_type	type;
+
+	value = get_value(token);
+	if (ft_isdigit(*value))
+		return (*value - '0');
+	type = get_type(token);
+	if (type == T_INPUT || type == T_HDOC || type == T_HSTR
+		|| type == T_RDWR || type == T_DUP_IN)
+		return (STDIN_FILENO);
+	return (STDOUT_FILENO);
 }
 
 /**
@@ -82,7 +132,7 @@ t_ast	*append_redir_node(t_ast *redir_chain, t_ast *new_redir)
  * and returns the chain.
  * If the token is a command argument, it is added to the `cmd_node`.
  * When a redirection is found, a new redirection node is created and 
- * added to the chain.
+ * added to the chain; the body of a heredoc is read at this point.
  *
  * @param tokens Pointer to the list of tokens.
  * @param cmd_node Command node to which arguments will be added.
@@ -103,6 +153,10 @@ t_ast	*extract_redirections(t_list **tokens, t_ast *cmd_node, t_shell *shell)
 				shell);
 		if (new_redir == NULL)
 			return (NULL);
+		new_redir->u_node_cont.redir.fd = redir_fd(*tokens);
+		if (get_type(*tokens) == T_HDOC
+			&& !collect_heredoc(&new_redir->u_node_cont.redir, shell))
+			return (NULL);
 		redir_chain = append_redir_node(redir_chain, new_redir);
 		*tokens = (*tokens)->next->next;
 	}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   special_params.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:06:41 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:06:41 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Formats PIPESTATUS as a space-separated list of statuses, the
+ * value of `${PIPESTATUS[@]}`.
+ *
+ * @param shell Pointer to the shell structure.
+ * @return The list, or NULL if no pipeline has completed yet.
+ */
+char	*format_pipestatus(t_shell *shell)
+{
+	t_outbuf	out;
+	char		*code;
+	int			i;
+
+	if (shell->pipestatus.count == 0)
+		return (NULL);
+	ft_bzero(&out, sizeof(t_outbuf));
+	i = 0;
+	while (i < shell->pipestatus.count)
+	{
+		if (i > 0)
+			outbuf_add(&out, " ", 1, shell);
+		code = manage_memory(ft_itoa(shell->pipestatus.codes[i]),
+				COMMAND_TRACK, shell);
+		outbuf_append(&out, code, shell);
+		i++;
+	}
+	return (out.data);
+}
+
+/**
+ * @brief Returns an element of PIPESTATUS.
+ *
+ * @param index Index of the stage in the last foreground pipeline.
+ * @param shell Pointer to the shell structure.
+ * @return Its status (tracked per command), or NULL if there is no such
+ * stage.
+ */
+char	*pipestatus_element(int index, t_shell *shell)
+{
+	if (index < 0 || index >= shell->pipestatus.count)
+		return (NULL);
+	return (manage_memory(ft_itoa(shell->pipestatus.codes[index]),
+			COMMAND_TRACK, shell));
+}
+
+/**
+ * @brief Returns the value of a special parameter maintained by the shell.
+ *
+ * Special parameters are not part of the environment and are looked up
+ * before it. As in bash, `$PIPESTATUS` expands to its first element, the
+ * status of the first stage of the last foreground pipeline; the others
+ * are reached with `${PIPESTATUS[n]}` and `${PIPESTATUS[@]}` (see
+ * `brace_param`).
+ *
+ * @param name Name of the parameter, without `$`.
+ * @param shell Pointer to the shell structure.
+ * @param found Set to true if `name` is a special parameter.
+ * @return The value (tracked per command), or NULL if it has none.
+ */
+static char	*get_special_param(char *name, bool *found, t_shell *shell)
+{
+	*found = true;
+	if (ft_strcmp(name, "PIPESTATUS") == 0)
+		return (pipestatus_element(0, shell));
+	*found = false;
+	return (NULL);
+}
+
+/**
+ * @brief Returns the value of `$!`.
+ *
+ * @param shell Pointer to the shell structure.
+ * @return The PID of the last background job (tracked per command), or
+ * NULL if no job was started yet.
+ */
+char	*last_bg_pid_value(t_shell *shell)
+{
+	if (shell->last_bg_pid == 0)
+		return (NULL);
+	return (manage_memory(ft_itoa(shell->last_bg_pid), COMMAND_TRACK, shell));
+}
+
+/**
+ * @brief Returns the value of a parameter for `$name` expansion.
+ *
+ * @param name Name of the parameter, without `$`.
+ * @param shell Pointer to the shell structure.
+ * @return The value of the special parameter `name` if there is one,
+ * otherwise the value of the environment variable, or NULL.
+ */
+char	*lookup_param(char *name, t_shell *shell)
+{
+	bool	found;
+	char	*value;
+
+	value = get_special_param(name, &found, shell);
+	if (found)
+		return (value);
+	return (get_ev_value(get_ev(name, shell->ev_list)));
+}
@@ -0,0 +1,98 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   special_params_second.c                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:34:46 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 01:34:46 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Measures the subscript of `${name[index]}`.
+ *
+ * @param str Text following the name.
+ * @return The length of `[@]`, `[*]` or `[n]`, 0 if there is no
+ * subscript, or -1 if it is not one of those.
+ */
+static int	subscript_len(char *str)
+{
+	int	i;
+
+	if (str[0] != '[')
+		return (0);
+	if ((str[1] == '@' || str[1] == '*') && str[2] == ']')
+		return (3);
+	i = 1;
+	while (ft_isdigit(str[i]) && i < 10)
+		i++;
+	if (i == 1 || str[i] != ']')
+		return (-1);
+	return (i + 1);
+}
+
+/**
+ * @brief Returns an element of a parameter.
+ *
+ * PIPESTATUS is the only array: `@` and `*` select all of its statuses,
+ * separated by spaces, and a number the status of one stage. Any other
+ * parameter is an array of one element, as in bash.
+ *
+ * @param name Name of the parameter.
+ * @param index The subscript, without its opening bracket.
+ * @param shell Pointer to the shell structure.
+ * @return The element (tracked per command), or NULL if it is unset.
+ */
+static char	*param_element(char *name, char *index, t_shell *shell)
+{
+	bool	is_all;
+
+	is_all = (*index == '@' || *index == '*');
+	if (ft_strcmp(name, "PIPESTATUS"))
+	{
+		if (is_all || ft_atoi(index) == 0)
+			return (lookup_param(name, shell));
+		return (NULL);
+	}
+	if (is_all)
+		return (format_pipestatus(shell));
+	return (pipestatus_element(ft_atoi(index), shell));
+}
+
+/**
+ * @brief Expands `${name}` or `${name[index]}`.
+ *
+ * Only these two forms are recognized; any other text after `${` is left
+ * as it is.
+ *
+ * @param str Text starting at the `$`.
+ * @param len Set to the length of the expansion, or to 0 if `str` does
+ * not start with one.
+ * @param shell Pointer to the shell structure.
+ * @return The value (tracked per command), or NULL if it is unset.
+ */
+char	*brace_param(char *str, size_t *len, t_shell *shell)
+{
+	char	*name;
+	size_t	i;
+	int		sub;
+
+	*len = 0;
+	i = 2;
+	if (str[1] != '{' || (!ft_isalpha(str[i]) && str[i] != '_'))
+		return (NULL);
+	while (ft_isalnum(str[i]) || str[i] == '_')
+		i++;
+	sub = subscript_len(str + i);
+	if (sub < 0 || str[i + sub] != '}')
+		return (NULL);
+	*len = i + sub + 1;
+	name = manage_memory(ft_substr(str, 2, i - 2), COMMAND_TRACK, shell);
+	if (sub == 0)
+		return (lookup_param(name, shell));
+	return (param_element(name, str + i + 1, shell));
+}
@@ -25,17 +25,15 @@
  * Detailed description:
  * 
  * 1. The function starts by initializing a list to hold resolved arguments.
- * 2. If the node type is CMD:
+ * 2. If the node type is CMD and its arguments were not resolved yet:
  *    - Extracts the command arguments and processes each of them, performing 
- * variable substitution.
- *    - Replaces the original command arguments with the resolved arguments.
- * 3. If the node type is REDIR and it's not a heredoc:
- *    - Extracts the filename and performs variable substitution.
- *    - Checks that there is exactly one argument left after substitution and
- *  that it is not empty.
- *    - If the argument is valid, replaces the original filename with the
- *  resolved one.
- *    - If the argument is invalid, outputs an error message.
+ * variable substitution (or process substitution, see `resolve_word`).
+ *    - Replaces the original command arguments with the resolved arguments
+ * and marks the node as resolved, so a node prepared by the parent is not
+ * expanded a second time in the child.
+ * 3. If the node type is REDIR and it's not a heredoc, expands its word
+ *  with `resolve_redir_word`: the file name, checked to be a single
+ *  non-empty word, or the body of a here-string.
  *
  * @param node The AST node to process.
  * @param shell The shell structure for memory management and syntax error
@@ -46,28 +44,20 @@ t_ast	*resolve_ast_content(t_ast *node, t_shell *shell)
 {
 	t_list	*args_to_resolve;
 	char	**cmd_args;
-	char	*filename;
 
 	args_to_resolve = NULL;
-	if (node->node_type == CMD)
+	if (node->node_type == CMD && !node->u_node_cont.cmd.is_resolved)
 	{
 		cmd_args = node->u_node_cont.cmd.cmd_args;
 		while (*cmd_args)
-			resolve_arg(*cmd_args++, &args_to_resolve, shell);
+			resolve_word(*cmd_args++, &args_to_resolve, shell);
 		node->u_node_cont.cmd.cmd_args = create_string_array(&args_to_resolve,
 				shell);
+		node->u_node_cont.cmd.is_resolved = true;
 	}
 	else if (node->node_type == REDIR
 		&& node->u_node_cont.redir.redir_type != T_HDOC)
-	{
-		filename = node->u_node_cont.redir.filename;
-		resolve_arg(filename, &args_to_resolve, shell);
-		if (ft_lstsize(args_to_resolve) != 1
-			|| !ft_strcmp(args_to_resolve->content, ""))
-			error_msg("redirection:", NULL, "invalid filename", shell);
-		else
-			node->u_node_cont.redir.filename = args_to_resolve->content;
-	}
+		resolve_redir_word(&node->u_node_cont.redir, shell);
 	return (node);
 }
 
@@ -78,15 +68,18 @@ t_ast	*resolve_ast_content(t_ast *node, t_shell *shell)
  * This function takes the `input` string, substitution context `context`, 
  * and shell structure `shell`.
  * It performs the following steps:
- * 1. Checks if the character following `$` is `?`:
- *    - If so, replaces it with the return code of the previous command.
- * 2. If not, and if the character is outside of quotes and the next character
+ * 1. Checks if the character following `$` is `(`: if so, expands the
+ *    command substitution (see `expand_cmd_subst`).
+ * 2. Checks if the character following `$` is `?` or `!`:
+ *    - If so, replaces it with the return code of the previous command, or
+ *    with the PID of the last background job.
+ * 3. If not, and if the character is outside of quotes and the next character
  * is `"` or `'`, returns without modification.
- * 3. Otherwise, searches for the value of the environment variable 
+ * 4. Otherwise, searches for the value of the environment variable 
  * specified after `$`.
- * 4. If a variable value is found and outside quotes, performs word 
+ * 5. If a variable value is found and outside quotes, performs word 
  * tokenization.
- * 5. If a variable value is found, adds it to the variable buffer.
+ * 6. If a variable value is found, adds it to the variable buffer.
  *
  * @param input The string containing environment variables for substitution.
  * @param context The substitution context holding the substitution state 
@@ -98,11 +91,17 @@ void	resolve_ev(char *input, t_subst_context *context, t_shell *shell)
 {
 	char	*var_value;
 
-	if (input[context->pos + 1] == '?')
+	var_value = NULL;
+	if (input[context->pos + 1] == '(')
+		expand_cmd_subst(input, context, shell);
+	else if (input[context->pos + 1] == '?' || input[context->pos + 1] == '!')
 	{
 		context->pos++;
-		var_value = manage_memory(ft_itoa(shell->prev_cmd_status),
-				COMMAND_TRACK, shell);
+		if (input[context->pos] == '?')
+			var_value = manage_memory(ft_itoa(shell->prev_cmd_status),
+					COMMAND_TRACK, shell);
+		else
+			var_value = last_bg_pid_value(shell);
 	}
 	else
 	{
@@ -128,8 +127,9 @@ void	resolve_ev(char *input, t_subst_context *context, t_shell *shell)
  * is not found or invalid,
  * the function returns `NULL`.
  *
- * 1. Checks if the environment variable starts with a valid character 
- * (letter or `_`).
+ * 1. Expands `${name}` and `${name[index]}` with `brace_param`.
+ * Otherwise, checks if the environment variable starts with a valid
+ * character (letter or `_`).
  * 2. If the character is not valid, adds the current character from 
  * `input` to the substitution buffer
  *    and returns `NULL`.
@@ -137,12 +137,10 @@ void	resolve_ev(char *input, t_subst_context *context, t_shell *shell)
  * characters (letters, digits, `_`) are found.
  * 4. Extracts the environment variable name from the string and allocates 
  * memory for it.
- * 5. If the variable name is not found or is invalid, adds the current 
- * character from `input` to the substitution buffer
- *    and returns `NULL`.
- * 6. Retrieves the value of the environment variable and updates the current
+ * 5. Retrieves the value of the parameter (a special parameter of the
+ *  shell, or else the environment variable) and updates the current
  *  position in the string.
- * 7. Returns the value of the environment variable.
+ * 6. Returns the value of the environment variable.
  *
  * @param input The string containing the environment variable to extract.
  * @param context The current substitution context holding the position and
@@ -156,7 +154,14 @@ char	*extract_ev_value(char *input, t_subst_context *context, t_shell *shell)
 	int		cur_pos;
 	char	*ev_name;
 	char	*ev_value;
+	size_t	len;
 
+	ev_value = brace_param(input + context->pos, &len, shell);
+	if (len)
+	{
+		context->pos += len - 1;
+		return (ev_value);
+	}
 	cur_pos = context->pos + 1;
 	if (!ft_isalpha(input[cur_pos]) && input[cur_pos] != '_')
 	{
@@ -168,13 +173,7 @@ char	*extract_ev_value(char *input, t_subst_context *context, t_shell *shell)
 		cur_pos++;
 	ev_name = manage_memory(ft_substr(input, context->pos + 1, cur_pos
 				- context->pos - 1), COMMAND_TRACK, shell);
-	if (ev_name == NULL)
-	{
-		context->subst_buffer[context->buf_pos++] = input[context->pos];
-		context->subst_buffer[context->buf_pos] = '\0';
-		return (NULL);
-	}
-	ev_value = get_ev_value(get_ev(ev_name, shell->ev_list));
+	ev_value = lookup_param(ev_name, shell);
 	context->pos += ft_strlen(ev_name);
 	return (ev_value);
 }
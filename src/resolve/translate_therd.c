@@ -127,3 +127,81 @@ t_list	*clean_file_list(t_list *file_list, t_subst_context *context)
 	}
 	return (file_list);
 }
+
+/**
+ * @brief Expands the word of a redirection.
+ *
+ * The word of a file redirection must expand to exactly one non-empty
+ * file name. The word of a here-string becomes its body instead: its
+ * fields are joined by single spaces and a newline is appended.
+ *
+ * @param redir The redirection; its file name or body is replaced.
+ * @param shell Pointer to the shell structure.
+ */
+void	resolve_redir_word(t_redir *redir, t_shell *shell)
+{
+	t_list		*words;
+	t_outbuf	body;
+
+	words = NULL;
+	resolve_word(redir->filename, &words, shell);
+	if (redir->redir_type == T_HSTR)
+	{
+		ft_bzero(&body, sizeof(t_outbuf));
+		while (words)
+		{
+			outbuf_append(&body, words->content, shell);
+			words = words->next;
+			if (words)
+				outbuf_add(&body, " ", 1, shell);
+		}
+		outbuf_add(&body, "\n", 1, shell);
+		redir->body = body.data;
+		redir->body_len = body.len;
+		redir->expand_body = false;
+	}
+	else if (ft_lstsize(words) != 1 || !ft_strcmp(words->content, ""))
+		error_msg("redirection:", NULL, "invalid filename", shell);
+	else
+		redir->filename = words->content;
+}
+
+/**
+ * @brief Expands a command substitution `$(...)` inside a word.
+ *
+ * The output replaces the substitution. Outside of double quotes it is
+ * split into words on spaces, tabs and newlines, as with the default IFS
+ * of bash; inside them it stays a single word, newlines included.
+ *
+ * @param input The word.
+ * @param context Substitution context, positioned on the `$`; it is moved
+ * to the closing parenthesis.
+ * @param shell Pointer to the shell structure.
+ */
+void	expand_cmd_subst(char *input, t_subst_context *context, t_shell *shell)
+{
+	size_t	len;
+	char	*value;
+	int		i;
+
+	len = subst_len(input + context->pos);
+	if (len == 0)
+	{
+		context->subst_buffer[context->buf_pos++] = input[context->pos];
+		context->subst_buffer[context->buf_pos] = '\0';
+		return ;
+	}
+	value = command_subst(manage_memory(ft_substr(input, context->pos + 2,
+					len - 3), COMMAND_TRACK, shell), shell);
+	context->pos += len - 1;
+	if (context->quote_mode == OUTSIDE)
+	{
+		i = -1;
+		while (value[++i])
+			if (value[i] == '\n' || value[i] == '\t')
+				value[i] = ' ';
+		value = tokenize_words(context, value, shell);
+	}
+	if (value)
+		expand_subst_buffer(value, context, shell);
+}
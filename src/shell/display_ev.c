@@ -13,95 +13,74 @@
 #include "minishell.h"
 
 /**
- * @brief Displays the environment variable list.
+ * @brief Appends one environment variable line to an output buffer.
  *
- * This function iterates through the environment variable list and prints 
- * each environment variable.
- * If `export_mode` is true, it prints variables in the format used by the 
- * `export` command (`declare -x`).
- * If `export_mode` is false, it prints only those variables that have a 
- non-null value.
+ * In export mode the line has the `declare -x NAME="VALUE"` form and
+ * variables without a value are listed by name only. Otherwise the line is
+ * `NAME=VALUE` and variables without a value are skipped.
  *
- * @param export_mode Boolean flag indicating whether to use export mode 
- (with `declare -x`) or not.
- * @param ev Pointer to the list of environment variables to be displayed.
- * @param shell Pointer to the shell structure for managing memory and 
- * file descriptors.
- * @return Returns `EXIT_SUCCESS` on completion.
+ * @param ev Environment variable to format.
+ * @param export_mode Whether to use the `export` listing format.
+ * @param out Output buffer receiving the line.
+ * @param shell Pointer to the shell structure for memory management.
  */
-int	display_ev_list(bool export_mode, t_list *ev, t_shell *shell)
+static void	append_ev_line(t_env_var *ev, bool export_mode, t_outbuf *out,
+		t_shell *shell)
 {
-	while (ev != NULL)
+	if (!export_mode && !ev->value)
+		return ;
+	if (export_mode)
+		outbuf_append(out, "declare -x ", shell);
+	outbuf_append(out, ev->name, shell);
+	if (export_mode && ev->value)
 	{
-		if (!export_mode && !get_ev_value(ev))
-		{
-			ev = ev->next;
-			continue ;
-		}
-		if (export_mode)
-			write_and_track("declare -x ", STDOUT_FILENO, shell);
-		write_and_track(get_ev_name(ev), STDOUT_FILENO, shell);
-		if (get_ev_value(ev))
-			write_and_track("=", STDOUT_FILENO, shell);
-		if (export_mode && get_ev_value(ev))
-		{
-			write_and_track("\"", STDOUT_FILENO, shell);
-			write_and_track(get_ev_value(ev), STDOUT_FILENO, shell);
-			write_and_track("\"", STDOUT_FILENO, shell);
-		}
-		else if (get_ev_value(ev))
-			write_and_track(get_ev_value(ev), STDOUT_FILENO, shell);
-		write_and_track("\n", STDOUT_FILENO, shell);
-		ev = ev->next;
+		outbuf_append(out, "=\"", shell);
+		outbuf_append(out, ev->value, shell);
+		outbuf_append(out, "\"", shell);
 	}
-	return (EXIT_SUCCESS);
+	else if (ev->value)
+	{
+		outbuf_append(out, "=", shell);
+		outbuf_append(out, ev->value, shell);
+	}
+	outbuf_append(out, "\n", shell);
 }
+
 /**
- * @brief Fills an array with environment variable strings.
+ * @brief Displays the environment variable list.
  *
- * This function populates a provided array with environment variable strings 
- * in the format `NAME=VALUE`.
- * It uses the environment variable list to construct the strings and tracks 
- * memory allocation.
+ * If `export_mode` is true, variables are printed in the format used by the
+ * `export` command (`declare -x`), ordered by name through the cached
+ * sorted index. Otherwise the list is printed in insertion order and only
+ * variables with a value are shown. The whole listing is assembled in
+ * `out`, which the caller writes with a single write.
  *
- * @param ev_array Array to be filled with environment variable strings.
- * @param ev_list Pointer to the list of environment variables.
- * @param shell Pointer to the shell structure for memory management.
+ * @param export_mode Boolean flag indicating whether to use export mode
+ * (with `declare -x`) or not.
+ * @param ev Pointer to the list of environment variables to be displayed.
+ * @param out Buffer receiving the listing.
+ * @param shell Pointer to the shell structure for managing memory and
+ * file descriptors.
+ * @return Returns `EXIT_SUCCESS` on completion.
  */
-
-static void	fill_ev_array(char **ev_array, t_list *ev_list, t_shell *shell)
+int	display_ev_list(bool export_mode, t_list *ev, t_outbuf *out,
+		t_shell *shell)
 {
-	int		i;
-	char	*ev_value;
-	char	*ev_name;
+	t_env_var	**sorted;
 
-	i = 0;
-	while (ev_list)
+	if (export_mode)
+	{
+		sorted = get_sorted_ev(shell);
+		while (*sorted)
+			append_ev_line(*sorted++, true, out, shell);
+	}
+	else
 	{
-		ev_value = get_ev_value(ev_list);
-		if (ev_value)
+		while (ev != NULL)
 		{
-			ev_name = strjoin_tracked(get_ev_name(ev_list), "=", COMMAND_TRACK,
-					shell);
-			ev_array[i] = strjoin_tracked(ev_name, ev_value, COMMAND_TRACK,
-					shell);
-			i++;
+			append_ev_line((t_env_var *)ev->content, false, out, shell);
+			ev = ev->next;
 		}
-		ev_list = ev_list->next;
 	}
-	ev_array[i] = NULL;
-}
-
-char	**create_ev_array(t_shell *shell)
-{
-	int		ev_count;
-	char	**env_array;
-
-	ev_count = ft_lstsize(shell->ev_list);
-	env_array = calloc_tracked(ev_count + 1, sizeof(char *), COMMAND_TRACK,
-			shell);
-	if (!env_array)
-		return (NULL);
-	fill_ev_array(env_array, shell->ev_list, shell);
-	return (env_array);
+	return (EXIT_SUCCESS);
 }
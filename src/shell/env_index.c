@@ -0,0 +1,96 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_index.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:50:23 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:50:23 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Orders two environment variables by name for `qsort`.
+ *
+ * @param a Pointer to the first `t_env_var *`.
+ * @param b Pointer to the second `t_env_var *`.
+ * @return Negative, zero or positive value, as `ft_strcmp`.
+ */
+static int	compare_ev_names(const void *a, const void *b)
+{
+	t_env_var	*first;
+	t_env_var	*second;
+
+	first = *(t_env_var **)a;
+	second = *(t_env_var **)b;
+	return (ft_strcmp(first->name, second->name));
+}
+
+/**
+ * @brief Marks the environment as modified.
+ *
+ * Every change to the variable list bumps the generation counter, which
+ * invalidates views derived from the list (such as the sorted index used by
+ * `export`). A change to PATH also bumps the PATH generation, which empties
+ * the command hash table on its next use.
+ *
+ * @param name Name of the variable that was added, changed or removed.
+ * @param shell Pointer to the shell structure.
+ */
+void	mark_ev_changed(char *name, t_shell *shell)
+{
+	shell->ev_gen++;
+	if (name && ft_strcmp(name, "PATH") == 0)
+		shell->path_gen++;
+}
+
+/**
+ * @brief Returns the environment variables sorted by name.
+ *
+ * The index is rebuilt lazily: it is kept between commands and only
+ * re-sorted when the environment generation has changed since the last
+ * build. The returned array is NULL-terminated and owned by the shell.
+ *
+ * @param shell Pointer to the shell structure.
+ * @return NULL-terminated array of environment variables in name order.
+ */
+t_env_var	**get_sorted_ev(t_shell *shell)
+{
+	t_ev_index	*index;
+	t_list		*node;
+	size_t		count;
+
+	index = &shell->ev_index;
+	if (index->vars && index->gen == shell->ev_gen)
+		return (index->vars);
+	free_ev_index(shell);
+	count = ft_lstsize(shell->ev_list);
+	index->vars = calloc_tracked(count + 1, sizeof(t_env_var *), UNTRACKED,
+			shell);
+	node = shell->ev_list;
+	count = 0;
+	while (node)
+	{
+		index->vars[count++] = (t_env_var *)node->content;
+		node = node->next;
+	}
+	qsort(index->vars, count, sizeof(t_env_var *), compare_ev_names);
+	index->gen = shell->ev_gen;
+	return (index->vars);
+}
+
+/**
+ * @brief Releases the sorted environment index and the cached envp.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	free_ev_index(t_shell *shell)
+{
+	free(shell->ev_index.vars);
+	shell->ev_index.vars = NULL;
+	free(shell->ev_index.envp);
+	shell->ev_index.envp = NULL;
+}
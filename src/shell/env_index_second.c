@@ -0,0 +1,112 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_index_second.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:59:12 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:59:12 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Computes the size of the packed envp block.
+ *
+ * @param ev_list Pointer to the list of environment variables.
+ * @param count Receives the number of exported variables with a value.
+ * @return Size in bytes of the pointer array and all `NAME=value` strings.
+ */
+static size_t	ev_array_size(t_list *ev_list, size_t *count)
+{
+	size_t	size;
+
+	size = 0;
+	*count = 0;
+	while (ev_list)
+	{
+		if (get_ev_value(ev_list))
+		{
+			size += ft_strlen(get_ev_name(ev_list))
+				+ ft_strlen(get_ev_value(ev_list)) + 2;
+			(*count)++;
+		}
+		ev_list = ev_list->next;
+	}
+	return (size + (*count + 1) * sizeof(char *));
+}
+
+/**
+ * @brief Copies one variable as `NAME=value` into the packed block.
+ *
+ * @param dst Destination inside the block.
+ * @param ev_node Node of the environment variable.
+ * @return Pointer just past the terminating NUL of the copied string.
+ */
+static char	*pack_ev(char *dst, t_list *ev_node)
+{
+	size_t	name_len;
+	size_t	value_len;
+
+	name_len = ft_strlen(get_ev_name(ev_node));
+	value_len = ft_strlen(get_ev_value(ev_node));
+	ft_memcpy(dst, get_ev_name(ev_node), name_len);
+	dst[name_len] = '=';
+	ft_memcpy(dst + name_len + 1, get_ev_value(ev_node), value_len);
+	dst[name_len + value_len + 1] = '\0';
+	return (dst + name_len + value_len + 2);
+}
+
+/**
+ * @brief Fills an envp array with the variables that have a value.
+ *
+ * @param envp Array to fill, large enough for every variable.
+ * @param cursor Start of the string area of the block.
+ * @param node First node of the environment list.
+ */
+static void	fill_ev_array(char **envp, char *cursor, t_list *node)
+{
+	size_t	count;
+
+	count = 0;
+	while (node)
+	{
+		if (get_ev_value(node))
+		{
+			envp[count++] = cursor;
+			cursor = pack_ev(cursor, node);
+		}
+		node = node->next;
+	}
+}
+
+/**
+ * @brief Returns the environment as an envp array for `execve`.
+ *
+ * The array and its strings live in a single block owned by the shell.
+ * It is kept between commands and only rebuilt when the environment
+ * generation has changed, so launching a program does not copy the
+ * variable list again. The caller must not modify or free the result.
+ *
+ * @param shell Pointer to the shell structure.
+ * @return NULL-terminated array of `NAME=value` strings.
+ */
+char	**get_ev_array(t_shell *shell)
+{
+	t_ev_index	*index;
+	size_t		count;
+
+	index = &shell->ev_index;
+	if (index->envp && index->envp_gen == shell->ev_gen)
+		return (index->envp);
+	free(index->envp);
+	index->envp = NULL;
+	index->envp = calloc_tracked(1, ev_array_size(shell->ev_list, &count),
+			UNTRACKED, shell);
+	fill_ev_array(index->envp, (char *)(index->envp + count + 1),
+			shell->ev_list);
+	index->envp_gen = shell->ev_gen;
+	return (index->envp);
+}
@@ -72,6 +72,7 @@ void	add_ev(char *name, char *value, t_list **ev_list, t_shell *shell)
 	if (value)
 		ev->value = strdup_tracked(value, UNTRACKED, shell);
 	lstadd_back_tracked(ev, ev_list, UNTRACKED, shell);
+	mark_ev_changed(name, shell);
 }
 /**
  * @brief Changes the value of an existing environment variable.
@@ -102,6 +103,7 @@ void	change_ev_val(t_list *ev_ptr, char *new_val,
 	else
 		ev->value = strdup_tracked(new_val, UNTRACKED, shell);
 	free(old_val);
+	mark_ev_changed(ev->name, shell);
 }
 
 /**
@@ -64,20 +64,24 @@ void	exit_on_sys_error(const char *cause, int errnum, t_shell *shell)
  * @brief Prints an error message with a system error description.
  *
  * This function prints an error message in the format
- * `minishell: <cause>: <system error>`.
- * The system error message is obtained using `perror` which uses 
- * `errno` to get the system error
- * string.
+ * `minishell: <cause>: <system error>` on the error stream of the shell
+ * (`shell->err_fd`, the stderr of the running builtin).
+ * The system error message is obtained using `strerror` on `errno`.
  *
  * @param cause The cause of the error.
- * @param shell Pointer to the shell structure (though unused in 
- * this function).
+ * @param shell Pointer to the shell structure.
  * @return The exit code `EXIT_FAILURE`.
  */
 int	error_msg_errno(char *cause, t_shell *shell)
 {
-	write_and_track("minishell: ", STDERR_FILENO, shell);
-	perror(cause);
+	char	*description;
+
+	description = strerror(errno);
+	write_and_track("minishell: ", shell->err_fd, shell);
+	write_and_track(cause, shell->err_fd, shell);
+	write_and_track(": ", shell->err_fd, shell);
+	write_and_track(description, shell->err_fd, shell);
+	write_and_track("\n", shell->err_fd, shell);
 	return (EXIT_FAILURE);
 }
 /**
@@ -86,7 +90,8 @@ int	error_msg_errno(char *cause, t_shell *shell)
  * This function prints an error message in the format
  * `minishell: <cause><faulty_el><msg>`,
  * where `<faulty_el>` and `<msg>` are optional and are 
- * included if provided.
+ * included if provided. It goes to the error stream of the shell
+ * (`shell->err_fd`, the stderr of the running builtin).
  *
  * @param cause The cause of the error.
  * @param faulty_el Additional context about the faulty 
@@ -98,12 +103,12 @@ int	error_msg_errno(char *cause, t_shell *shell)
 
 int	error_msg(char *cause, char *faulty_el, char *msg, t_shell *shell)
 {
-	write_and_track("minishell: ", STDERR_FILENO, shell);
-	write_and_track(cause, STDERR_FILENO, shell);
+	write_and_track("minishell: ", shell->err_fd, shell);
+	write_and_track(cause, shell->err_fd, shell);
 	if (faulty_el)
-		write_and_track(faulty_el, STDERR_FILENO, shell);
-	write_and_track(msg, STDERR_FILENO, shell);
-	write_and_track("\n", STDERR_FILENO, shell);
+		write_and_track(faulty_el, shell->err_fd, shell);
+	write_and_track(msg, shell->err_fd, shell);
+	write_and_track("\n", shell->err_fd, shell);
 	return (EXIT_FAILURE);
 }
 
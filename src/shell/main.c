@@ -14,6 +14,37 @@
 
 sig_atomic_t	g_signal = 0;
 
+/**
+ * @brief Initializes the execution state: caches and shell options.
+ *
+ * @param shell Pointer to the shell structure to initialize.
+ */
+static void	init_exec_state(t_shell *shell)
+{
+	shell->ev_gen = 0;
+	shell->ev_index.vars = NULL;
+	shell->ev_index.envp = NULL;
+	shell->path_gen = 0;
+	shell->hash_gen = 0;
+	ft_bzero(shell->cmd_hash, sizeof(shell->cmd_hash));
+	ft_bzero(&shell->path_dirs, sizeof(t_path_dirs));
+	ft_bzero(&shell->neg_cache, sizeof(t_neg_cache));
+	ft_bzero(&shell->pipestatus, sizeof(t_pipestatus));
+	ft_bzero(&shell->sup, sizeof(t_supervisor));
+	shell->sup.epfd = -1;
+	shell->fs_epoch = 0;
+	shell->pipefail = false;
+	shell->jobs = NULL;
+	shell->last_bg_pid = 0;
+	shell->is_async = false;
+	ft_bzero(&shell->child_usage, sizeof(struct rusage));
+	shell->broken_pipe = false;
+	shell->held_fds[0] = -1;
+	shell->held_fds[1] = -1;
+	shell->err_fd = STDERR_FILENO;
+	shell->proc_substs = NULL;
+}
+
 /**
  * @brief Initializes the shell environment.
  *
@@ -32,7 +63,8 @@ void	setup_shell(t_shell *shell, char **env_vars)
 	shell->mem_tracker[UNTRACKED] = NULL;
 	shell->mem_tracker[CORE_TRACK] = NULL;
 	shell->mem_tracker[COMMAND_TRACK] = NULL;
-	shell->temp_files = NULL;
+	shell->hdoc_interrupted = false;
+	init_exec_state(shell);
 	shell->ev_list = create_ev_list(env_vars, shell);
 	update_shell_level(shell);
 	shell->syntax_error = NULL;
@@ -96,6 +128,13 @@ void	clean_exit(int exit_code, t_shell *shell)
 			ft_putstr_fd("exit\n", STDERR_FILENO);
 		cleanup_shell(shell);
 		ft_lstclear(&shell->ev_list, free_ev);
+		free_ev_index(shell);
+		hash_reset(shell);
+		free_path_dirs(shell);
+		neg_cache_clear(shell);
+		free(shell->pipestatus.codes);
+		free_jobs(shell);
+		supervisor_reset(shell);
 		ft_lstclear(&shell->mem_tracker[CORE_TRACK], free);
 	}
 	rl_clear_history();
@@ -64,13 +64,53 @@ int	display_synt_err(t_shell *shell)
 	return (2);
 }
 
+/**
+ * @brief Returns the length of a substitution.
+ *
+ * A process substitution (`<(`, `>(`) or a command substitution (`$(`)
+ * runs to the matching parenthesis; quoted and escaped characters inside
+ * it do not count.
+ *
+ * @param input The input string, starting with the two-character opener.
+ * @return The length up to and including the matching parenthesis, or 0
+ * if it is not closed.
+ */
+size_t	subst_len(const char *input)
+{
+	size_t	len;
+	int		depth;
+	char	quote;
+
+	depth = 0;
+	len = 0;
+	while (input[++len])
+	{
+		if (input[len] == '\\' && input[len + 1])
+			len++;
+		else if (input[len] == '\'' || input[len] == '"')
+		{
+			quote = input[len];
+			while (input[len + 1] && input[len + 1] != quote)
+				len++;
+			len += (input[len + 1] == quote);
+		}
+		else if (input[len] == '(')
+			depth++;
+		else if (input[len] == ')' && --depth == 0)
+			return (len + 1);
+	}
+	return (0);
+}
+
 /**
  * @brief Determines the token type of the input string.
  *
  * This function identifies the type of the token at the beginning of
  * the input string
  * and updates the length of the token. It handles various token types such as 
- * ampersands, pipes, redirects, and braces.
+ * ampersands, pipes, redirects, and braces. A single digit directly before
+ * a redirect is the descriptor it applies to, and is kept in the token.
+ * `<(` and `>(` start a process substitution word.
  *
  * @param input The input string to tokenize.
  * @param len Pointer to the length of the token.
@@ -79,6 +119,21 @@ int	display_synt_err(t_shell *shell)
  */
 t_tkn_type	get_tkn_type(char *input, size_t *len, t_shell *shell)
 {
+	t_tkn_type	type;
+
+	if (ft_isdigit(*input) && (input[1] == '<' || input[1] == '>'))
+	{
+		type = get_redirect(input + 1, input[1], len, shell);
+		*len += 1;
+		return (type);
+	}
+	if ((*input == '<' || *input == '>') && input[1] == '(')
+	{
+		*len = subst_len(input);
+		if (*len == 0)
+			return (record_synt_err("newline", shell), T_ERR);
+		return (T_TEXT);
+	}
 	if (*input == '&')
 		return (get_ampersand(input, len, shell));
 	else if (*input == '|')
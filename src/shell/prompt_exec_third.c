@@ -34,19 +34,26 @@ t_tkn_type	get_braces(char *input, size_t *len)
 /**
  * @brief Determines the type of ampersand token and updates the token length.
  *
- * This function identifies if the token is a single '&' or a double '&&' 
- * and updates the length of the token. If the token is invalid, it records a 
- * syntax error.
+ * This function identifies if the token is a single '&', a double '&&', or
+ * the redirection of both output streams '&>' or '&>>', and updates the
+ * length of the token. If the token is invalid, it records a syntax error.
  *
  * @param input The input string containing the ampersand token.
  * @param len Pointer to the length of the token.
  * @param shell Pointer to the shell structure.
- * @return T_AND if '&&', T_ERR if invalid token.
+ * @return T_BG if '&', T_AND if '&&', T_OUT_ALL if '&>', T_APPEND_ALL if
+ * '&>>', T_ERR if invalid token.
  */
 t_tkn_type	get_ampersand(char *input, size_t *len, t_shell *shell)
 {
+	if (input[1] == '>' && input[2] == '>')
+		return (*len = 3, T_APPEND_ALL);
+	if (input[1] == '>')
+		return (*len = 2, T_OUT_ALL);
 	while (input[*len] == '&')
 		(*len)++;
+	if (*len == 1)
+		return (T_BG);
 	if (*len == 2)
 		return (T_AND);
 	record_synt_err("&", shell);
@@ -81,7 +88,8 @@ t_tkn_type	get_pipe(char *input, size_t *len, t_shell *shell)
  * @brief Determines the type of redirect token and updates the token length.
  *
  * This function identifies if the token is an input '<', here-doc '<<',
- * output '>', or append '>>' and updates the length of the token.
+ * here-string '<<<', read-write '<>', output '>', append '>>', or a
+ * duplication '<&' or '>&', and updates the length of the token.
  * If the token is invalid, it records a syntax error.
  *
  * @param input The input string containing the redirect token.
@@ -94,12 +102,22 @@ t_tkn_type	get_redirect(char *input, char c, size_t *len, t_shell *shell)
 {
 	while (input[*len] == c)
 		*len += 1;
+	if (*len == 1 && (input[1] == '&' || (c == '<' && input[1] == '>')))
+		*len += 1;
 	if (c == '<' && *len == 1)
 		return (T_INPUT);
+	else if (c == '<' && input[1] == '&')
+		return (T_DUP_IN);
+	else if (c == '<' && input[1] == '>')
+		return (T_RDWR);
 	else if (c == '<' && *len == 2)
 		return (T_HDOC);
+	else if (c == '<' && *len == 3)
+		return (T_HSTR);
 	else if (c == '>' && *len == 1)
 		return (T_OUTPUT);
+	else if (c == '>' && input[1] == '&')
+		return (T_DUP_OUT);
 	else if (c == '>' && *len == 2)
 		return (T_APPEND);
 	record_synt_err(input, shell);
@@ -111,7 +129,8 @@ t_tkn_type	get_redirect(char *input, char c, size_t *len, t_shell *shell)
  *
  * This function processes the input string to handle quotes and escape 
  * characters,
- * updating the token length accordingly.
+ * updating the token length accordingly. A command substitution outside
+ * single quotes is part of the word up to its matching parenthesis.
  *
  * @param input The input string containing the token.
  * @param len Pointer to the length of the token.
@@ -135,6 +154,9 @@ void	handle_quotes_and_escapes(char *input, size_t *len,
 			else if (*in_quote && input[*len] == *c)
 				*in_quote = false;
 		}
+		else if (input[*len] == '$' && input[*len + 1] == '('
+			&& (!*in_quote || *c == '"') && subst_len(input + *len))
+			*len += subst_len(input + *len) - 1;
 		else if ((is_special_tkn(input[*len]) || ft_isspace(input[*len]))
 			&& !*in_quote)
 			break ;
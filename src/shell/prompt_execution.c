@@ -129,5 +129,6 @@ int	process_input(char *input_str, t_shell *shell)
 	if (result != EXIT_SUCCESS || parse_tree == NULL)
 		return (result);
 	result = run_cmd(parse_tree, OP_COMPLETE, shell);
+	finish_proc_substs(shell);
 	return (result);
 }
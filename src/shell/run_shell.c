@@ -17,7 +17,8 @@
  *
  * This function continuously prompts the user for input, processes the input,
  * and executes the corresponding commands. It also handles cleanup and 
- * signal interruptions.
+ * signal interruptions, and reports finished background jobs before each
+ * prompt.
  *
  * @param shell Pointer to the shell structure.
  * @return The exit status of the last command executed.
@@ -28,6 +29,7 @@ int	run_shell(t_shell *shell)
 
 	while (true)
 	{
+		report_jobs(shell);
 		input_str = get_input(IN_STD);
 		if (g_signal == SIGINT)
 			shell->prev_cmd_status = 130;
@@ -47,23 +49,18 @@ int	run_shell(t_shell *shell)
 }
 
 /**
- * @brief Cleans up shell resources, such as temporary files and memory.
+ * @brief Cleans up the resources of the last command line.
  *
- * This function removes temporary files, clears tracked memory, and resets 
- * the syntax error state.
+ * This function clears the memory tracked for the command and resets the
+ * syntax error state.
  *
  * @param shell Pointer to the shell structure.
  */
 void	cleanup_shell(t_shell *shell)
 {
-	while (shell->is_main && shell->temp_files)
-	{
-		if (unlink(shell->temp_files->content) == -1)
-			error_msg_errno("unlink", shell);
-		shell->temp_files = shell->temp_files->next;
-	}
 	ft_lstclear(&(shell->mem_tracker[COMMAND_TRACK]), free);
 	shell->syntax_error = NULL;
+	shell->hdoc_interrupted = false;
 }
 
 /**
@@ -12,6 +12,23 @@
 
 #include "minishell.h"
 
+/**
+ * @brief Sets the signal dispositions of a forked child running shell code.
+ *
+ * A foreground child gets the default actions back; a child of a background
+ * job keeps SIGINT and SIGQUIT ignored, so that ^C only reaches the
+ * foreground.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	signals_child(t_shell *shell)
+{
+	if (shell->is_async)
+		signals_ignore();
+	else
+		signals_default();
+}
+
 void	signal_heredoc(void)
 {
 	conf_signal(SIGINT, on_sigint_doc);
@@ -0,0 +1,71 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   signals_third.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 01:16:05 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 01:16:05 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Records a ^C for a builtin running inside the shell.
+ *
+ * @param signum The signal number.
+ */
+static void	on_sigint_flag(int signum)
+{
+	g_signal = signum;
+}
+
+/**
+ * @brief Lets ^C interrupt a builtin that runs inside the shell.
+ *
+ * The shell ignores SIGINT while commands run, which would make a
+ * long-running builtin impossible to stop. The handler installed here
+ * only records the signal; it is installed without SA_RESTART, so a
+ * blocking call of the builtin fails with EINTR and the builtin can
+ * check `g_signal`. A forked shell keeps its own dispositions (default,
+ * or ignored in a background job) and only has a stale `g_signal`
+ * cleared.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	catch_sigint(t_shell *shell)
+{
+	g_signal = 0;
+	if (shell->is_main)
+		conf_signal(SIGINT, on_sigint_flag);
+}
+
+/**
+ * @brief Ignores SIGINT again after `catch_sigint`.
+ *
+ * @param shell Pointer to the shell structure.
+ */
+void	release_sigint(t_shell *shell)
+{
+	if (shell->is_main)
+		conf_signal(SIGINT, SIG_IGN);
+}
+
+/**
+ * @brief Tells whether a ^C stopped the running builtin.
+ *
+ * A signal that arrives during a copy may only shorten it instead of
+ * failing it with EINTR, so copy loops check this after every call.
+ *
+ * @return true, with `errno` set to EINTR, after a ^C (see
+ * `catch_sigint`).
+ */
+bool	sigint_received(void)
+{
+	if (g_signal != SIGINT)
+		return (false);
+	errno = EINTR;
+	return (true);
+}
@@ -36,7 +36,8 @@ char	*strdup_tracked(char const *str, t_mem_trackers tracker, t_shell *shell)
  * @brief Writes a string to a file descriptor and handles any errors.
  *
  * This function writes a string to a specified file descriptor and tracks the
- * number of bytes written. If the write operation fails, it triggers an error.
+ * number of bytes written. If the write operation fails, it triggers an error,
+ * except for a closed pipe, which is recorded in `shell->broken_pipe`.
  *
  * @param str The string to write.
  * @param fd The file descriptor to write to.
@@ -50,7 +51,9 @@ ssize_t	write_and_track(const char *str, int fd, t_shell *shell)
 	if (!str)
 		exit_on_sys_error("write", EINVAL, shell);
 	result = write(fd, str, strlen(str));
-	if (result == -1)
+	if (result == -1 && errno == EPIPE)
+		shell->broken_pipe = true;
+	else if (result == -1)
 		exit_on_sys_error("write", errno, shell);
 	return (result);
 }
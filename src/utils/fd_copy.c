@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   fd_copy.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 00:16:18 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/19 00:16:18 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Writes a whole block of bytes to a descriptor.
+ *
+ * @param fd Descriptor to write to.
+ * @param data Bytes to write.
+ * @param len Number of bytes to write.
+ * @return 0 on success, or -1 on a write error.
+ */
+int	write_all(int fd, const char *data, ssize_t len)
+{
+	ssize_t	done;
+	ssize_t	ret;
+
+	done = 0;
+	while (done < len)
+	{
+		ret = write(fd, data + done, len - done);
+		if (ret == -1 && errno != EINTR)
+			return (-1);
+		if (ret > 0)
+			done += ret;
+	}
+	return (0);
+}
+
+/**
+ * @brief Copies the rest of a descriptor through a user-space buffer.
+ *
+ * @param src_fd Descriptor to read from.
+ * @param dst_fd Descriptor to write to.
+ * @return 0 on success, or -1 on an I/O error.
+ */
+static int	copy_by_read(int src_fd, int dst_fd)
+{
+	char	buf[COPY_BUF_SIZE];
+	ssize_t	len;
+
+	len = 1;
+	while (len != 0)
+	{
+		len = read(src_fd, buf, sizeof(buf));
+		if (sigint_received() || (len == -1 && errno != EINTR))
+			return (-1);
+		if (len > 0 && write_all(dst_fd, buf, len) == -1)
+			return (-1);
+	}
+	return (0);
+}
+
+/**
+ * @brief Picks the fastest way to move data between two descriptors.
+ *
+ * `copy_file_range` lets the filesystem copy (or share) extents between
+ * two regular files, `splice` moves pages in and out of a pipe and
+ * `sendfile` reads from anything backed by the page cache. A regular file
+ * that reports no size, such as a /proc file, may still have contents
+ * that `copy_file_range` would not see, so it is left to `sendfile`.
+ *
+ * @param src_fd Descriptor to read from.
+ * @param dst_fd Descriptor to write to.
+ * @return The first method to try.
+ */
+static t_copy_mode	pick_copy_mode(int src_fd, int dst_fd)
+{
+	struct stat	src;
+	struct stat	dst;
+
+	if (fstat(src_fd, &src) == -1 || fstat(dst_fd, &dst) == -1)
+		return (COPY_READ);
+	if (S_ISREG(src.st_mode) && S_ISREG(dst.st_mode) && src.st_size > 0)
+		return (COPY_RANGE);
+	if (S_ISFIFO(src.st_mode) || S_ISFIFO(dst.st_mode))
+		return (COPY_SPLICE);
+	return (COPY_SENDFILE);
+}
+
+/**
+ * @brief Moves one chunk inside the kernel, or gives up on the method.
+ *
+ * A method the descriptors do not support (another filesystem, a file
+ * opened for appending, a terminal, ...) is replaced by the next one in
+ * `t_copy_mode` order; the offsets of both descriptors are kept by the
+ * kernel, so the next method resumes where the failed one stopped.
+ * `copy_file_range` is asked for a much larger range than the others, as
+ * the filesystem may clone it in a single call.
+ *
+ * @param mode Method in use, advanced when it is not supported.
+ * @param src_fd Descriptor to read from.
+ * @param dst_fd Descriptor to write to.
+ * @return Number of bytes moved, 0 at the end of the input, 1 after a
+ * change of method, or -1 on an error.
+ */
+static ssize_t	copy_chunk(t_copy_mode *mode, int src_fd, int dst_fd)
+{
+	ssize_t	moved;
+
+	if (*mode == COPY_RANGE)
+		moved = copy_file_range(src_fd, NULL, dst_fd, NULL, RANGE_CHUNK,
+				0);
+	else if (*mode == COPY_SPLICE)
+		moved = splice(src_fd, NULL, dst_fd, NULL, COPY_CHUNK, SPLICE_F_MOVE);
+	else
+		moved = sendfile(dst_fd, src_fd, NULL, COPY_CHUNK);
+	if (moved == -1 && (errno == EINVAL || errno == ENOSYS || errno == EXDEV
+			|| errno == EOPNOTSUPP || (errno == EBADF && *mode == COPY_RANGE)))
+	{
+		*mode = *mode + 1;
+		return (1);
+	}
+	return (moved);
+}
+
+/**
+ * @brief Copies the rest of a descriptor to another one.
+ *
+ * The data stays in the kernel whenever the descriptors allow it (see
+ * `pick_copy_mode`); otherwise it is copied with `read`/`write`. An
+ * interrupted call is retried; a ^C (see `catch_sigint`) stops the copy
+ * after the current call, even when the call was only shortened.
+ *
+ * @param src_fd Descriptor to read from, from its current offset.
+ * @param dst_fd Descriptor to write to.
+ * @return 0 on success, or -1 on an I/O error or a ^C.
+ */
+int	copy_fd_contents(int src_fd, int dst_fd)
+{
+	t_copy_mode	mode;
+	ssize_t		moved;
+
+	mode = pick_copy_mode(src_fd, dst_fd);
+	moved = 1;
+	while (mode != COPY_READ && moved != 0)
+	{
+		moved = copy_chunk(&mode, src_fd, dst_fd);
+		if (sigint_received() || (moved == -1 && errno != EINTR))
+			return (-1);
+	}
+	if (mode == COPY_READ)
+		return (copy_by_read(src_fd, dst_fd));
+	return (0);
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   outbuf.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: ogoman <ogoman@student.hive.fi>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 23:50:07 by ogoman            #+#    #+#             */
+/*   Updated: 2026/10/18 23:50:07 by ogoman           ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "minishell.h"
+
+/**
+ * @brief Appends a block of bytes to an output buffer.
+ *
+ * The buffer grows geometrically, so building a listing of N lines costs
+ * O(log N) allocations instead of one `write` syscall per fragment.
+ * Memory is tracked in `COMMAND_TRACK` and released with the command.
+ *
+ * @param buf Pointer to the output buffer.
+ * @param data Bytes to append.
+ * @param len Number of bytes to append.
+ * @param shell Pointer to the shell structure for memory management.
+ */
+void	outbuf_add(t_outbuf *buf, const char *data, size_t len, t_shell *shell)
+{
+	size_t	new_cap;
+	char	*new_data;
+
+	if (buf->len + len + 1 > buf->cap)
+	{
+		new_cap = buf->cap * 2;
+		if (new_cap < OUTBUF_MIN_CAP)
+			new_cap = OUTBUF_MIN_CAP;
+		while (new_cap < buf->len + len + 1)
+			new_cap *= 2;
+		new_data = calloc_tracked(new_cap, sizeof(char), COMMAND_TRACK, shell);
+		if (buf->len > 0)
+			ft_memcpy(new_data, buf->data, buf->len);
+		buf->data = new_data;
+		buf->cap = new_cap;
+	}
+	ft_memcpy(buf->data + buf->len, data, len);
+	buf->len += len;
+	buf->data[buf->len] = '\0';
+}
+
+/**
+ * @brief Appends a NUL-terminated string to an output buffer.
+ *
+ * @param buf Pointer to the output buffer.
+ * @param str String to append.
+ * @param shell Pointer to the shell structure for memory management.
+ */
+void	outbuf_append(t_outbuf *buf, const char *str, t_shell *shell)
+{
+	if (!str)
+		exit_on_sys_error("outbuf", EINVAL, shell);
+	outbuf_add(buf, str, ft_strlen(str), shell);
+}
+
+/**
+ * @brief Writes the whole buffer to a file descriptor and empties it.
+ *
+ * Short writes are retried until every byte is out, so the caller issues
+ * a single logical write for the buffered block. A closed pipe stops the
+ * flush and is recorded in `shell->broken_pipe`; any other write error
+ * stops it too and is left to the caller to report, so a full disk does
+ * not end the shell.
+ *
+ * @param buf Pointer to the output buffer.
+ * @param fd File descriptor to write to.
+ * @param shell Pointer to the shell structure.
+ * @return Number of bytes written, or -1 on a write error other than
+ * EPIPE, with `errno` set.
+ */
+ssize_t	outbuf_flush(t_outbuf *buf, int fd, t_shell *shell)
+{
+	size_t	written;
+	ssize_t	result;
+
+	written = 0;
+	while (written < buf->len)
+	{
+		result = write(fd, buf->data + written, buf->len - written);
+		if (result == -1 && errno == EINTR)
+			continue ;
+		if (result == -1 && errno == EPIPE)
+		{
+			shell->broken_pipe = true;
+			break ;
+		}
+		if (result == -1)
+		{
+			buf->len = 0;
+			return (-1);
+		}
+		written += result;
+	}
+	buf->len = 0;
+	return (written);
+}
+
+/**
+ * @brief Appends a non-negative number in decimal to an output buffer.
+ *
+ * @param buf Pointer to the output buffer.
+ * @param n Number to append; negative values are written as 0.
+ * @param width Minimum number of digits, padded with leading zeros.
+ * @param shell Pointer to the shell structure for memory management.
+ */
+void	outbuf_append_num(t_outbuf *buf, long long n, int width,
+		t_shell *shell)
+{
+	char	digits[24];
+	int		pos;
+
+	if (n < 0)
+		n = 0;
+	pos = sizeof(digits);
+	while (pos > 0 && (n > 0 || pos == (int) sizeof(digits)
+			|| (int) sizeof(digits) - pos < width))
+	{
+		digits[--pos] = '0' + n % 10;
+		n /= 10;
+	}
+	outbuf_add(buf, digits + pos, sizeof(digits) - pos, shell);
+}
+
+/**
+ * @brief Appends a value given in millionths with a fixed number of decimals.
+ *
+ * For instance, 1234567 microseconds with 3 decimals gives `1.234`.
+ *
+ * @param buf Pointer to the output buffer.
+ * @param micros Value in millionths of the unit to print.
+ * @param decimals Number of decimals (at most 6); extra digits are cut.
+ * @param shell Pointer to the shell structure for memory management.
+ */
+void	outbuf_append_fixed(t_outbuf *buf, long long micros, int decimals,
+		t_shell *shell)
+{
+	long long	frac;
+	int			i;
+
+	outbuf_append_num(buf, micros / 1000000, 1, shell);
+	outbuf_add(buf, ".", 1, shell);
+	frac = micros % 1000000;
+	i = decimals;
+	while (i++ < 6)
+		frac /= 10;
+	outbuf_append_num(buf, frac, decimals, shell);
+}
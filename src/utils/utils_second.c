@@ -49,39 +49,37 @@ void	append_str(char ***args, char *str, t_shell *shell)
 }
 
 /**
- * @brief Waits for a child process to terminate and handles errors.
+ * @brief Waits for a given child process to terminate.
  *
- * This function uses the `wait` system call to wait for a child process
- * to terminate.
- * In case of an error (i.e., `wait` returns -1), it calls `exit_on_sys_error` 
- * to print an error message and terminate the program.
+ * The child is awaited through the supervisor, which is the only place
+ * where processes are reaped: waiting for one command never reaps a
+ * process that belongs to another one, and the children that exit in the
+ * meantime keep their status until they are awaited.
  *
+ * @param pid PID of the child process to wait for.
  * @param status Pointer to an integer where the exit status of the child
  * process will be stored.
  * @param shell Pointer to the shell structure for process management.
  * @return The PID of the terminated child process, or terminates the program
  * with an error message.
  */
-pid_t	wait_for_child(int *status, t_shell *shell)
+pid_t	wait_for_child(pid_t pid, int *status, t_shell *shell)
 {
-	pid_t	child_pid;
-	bool	error_occurred;
+	t_child	child;
 
-	child_pid = wait(status);
-	error_occurred = (child_pid == -1);
-	if (error_occurred)
-		exit_on_sys_error("wait failed", errno, shell);
-	return (child_pid);
+	child = await_child(pid, shell);
+	*status = child.status;
+	return (child.pid);
 }
 
 /**
- * @brief Creates a pipe and handles errors.
+ * @brief Creates a close-on-exec pipe and handles errors.
  *
- * This function uses the `pipe` system call to create a pipe. If an
- * error occurs 
- * (i.e., `pipe` returns -1), it calls `exit_on_sys_error` to print an 
- * error message 
- * and terminate the program.
+ * This function uses the `pipe2` system call with O_CLOEXEC, so neither end
+ * leaks into a program that does not explicitly receive it (a descriptor
+ * moved onto stdin/stdout with `dup2` loses the flag). If an error occurs
+ * (i.e., `pipe2` returns -1), it calls `exit_on_sys_error` to print an
+ * error message and terminate the program.
  *
  * @param pipe_fds Array of two integers to hold the pipe file descriptors.
  * @param shell Pointer to the shell structure for process management.
@@ -93,7 +91,7 @@ int	create_pipe(int pipe_fds[2], t_shell *shell)
 	int		pipe_status;
 	bool	error_occurred;
 
-	pipe_status = pipe(pipe_fds);
+	pipe_status = pipe2(pipe_fds, O_CLOEXEC);
 	error_occurred = (pipe_status == -1);
 	if (error_occurred)
 		exit_on_sys_error("pipe failed", errno, shell);
@@ -137,7 +135,9 @@ int	execute_program(const char *path, char *const args[], char *const env[],
  * If `fork`
  * fails (returns -1), it calls `exit_on_sys_error` to print an error 
  * message
- * and terminate the program.
+ * and terminate the program. The parent starts supervising the new child;
+ * the child starts with an empty supervisor and job table of its own, and
+ * closes the pipe ends the parent holds for a builtin stage.
  *
  * @param shell Pointer to the shell structure for process management.
  * @return PID of the new process on success, otherwise terminates the 
@@ -152,5 +152,13 @@ pid_t	create_process(t_shell *shell)
 	error_occurred = (process_id == -1);
 	if (error_occurred)
 		exit_on_sys_error("fork failed", errno, shell);
+	if (process_id == 0)
+	{
+		supervisor_reset(shell);
+		free_jobs(shell);
+		release_held_fds(shell);
+	}
+	else
+		supervise_child(process_id, shell);
 	return (process_id);
 }
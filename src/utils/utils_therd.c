@@ -62,3 +62,27 @@ int	close_directory(DIR *directory, t_shell *shell)
 		exit_on_sys_error("failed to close directory", errno, shell);
 	return (close_status);
 }
+
+/**
+ * @brief Moves a descriptor the shell keeps above fds 0 to 9.
+ *
+ * `exec` can rebind any of fds 0 to 9 of the shell for good, so the
+ * descriptors the shell holds across commands (its epoll instance,
+ * pidfds, PATH directories) must not live there.
+ *
+ * @param fd A close-on-exec descriptor, or -1.
+ * @return The descriptor, moved above FD_MAP_SIZE - 1 if needed and
+ * possible.
+ */
+int	raise_fd(int fd)
+{
+	int	high;
+
+	if (fd == -1 || fd >= FD_MAP_SIZE)
+		return (fd);
+	high = fcntl(fd, F_DUPFD_CLOEXEC, FD_MAP_SIZE);
+	if (high == -1)
+		return (fd);
+	close(fd);
+	return (high);
+}